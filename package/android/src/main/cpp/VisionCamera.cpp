@@ -1,9 +1,13 @@
 #include "JFrameProcessor.h"
 #include "JSharedArray.h"
+#include "JTypedResult.h"
+#include "JTypedResultSchema.h"
 #include "JVisionCameraProxy.h"
 #include "JVisionCameraScheduler.h"
+#include "ThreadPool.h"
 #include "VisionCameraProxy.h"
 #include <fbjni/fbjni.h>
+#include <functional>
 #include <jni.h>
 
 JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*) {
@@ -12,8 +16,15 @@ JNIEXPORT jint JNICALL JNI_OnLoad(JavaVM* vm, void*) {
     vision::JVisionCameraProxy::registerNatives();
     vision::JVisionCameraScheduler::registerNatives();
 #if VISION_CAMERA_ENABLE_FRAME_PROCESSORS
+    // Parallel Plugins call into Java from the shared ThreadPool, so its workers stay attached to the JVM (with the app's
+    // ClassLoader) for their whole life instead of attaching and detaching for every Plugin call.
+    vision::ThreadPool::setSharedWorkerScope([](const std::function<void()>& runWorker) {
+      facebook::jni::ThreadScope::WithClassLoader([&] { runWorker(); });
+    });
     vision::JFrameProcessor::registerNatives();
     vision::JSharedArray::registerNatives();
+    vision::JTypedResultSchema::registerNatives();
+    vision::JTypedResult::registerNatives();
 #endif
   });
 }
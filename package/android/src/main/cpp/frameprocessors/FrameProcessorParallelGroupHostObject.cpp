@@ -0,0 +1,138 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#include "FrameProcessorParallelGroupHostObject.h"
+#include "JSIJNIConversion.h"
+#include "PlatformFrame.h"
+#include "ThreadPool.h"
+#include <exception>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+FrameProcessorParallelGroupHostObject::FrameProcessorParallelGroupHostObject(std::vector<Stage> stages) : _stages(std::move(stages)) {}
+
+FrameProcessorParallelGroupHostObject::~FrameProcessorParallelGroupHostObject() {
+  // Hermes GC might destroy HostObjects on an arbitrary Thread which might not be
+  // connected to the JNI environment, so connect to it before releasing the Java Plugins.
+  jni::ThreadScope::WithClassLoader([&] { _stages.clear(); });
+}
+
+std::shared_ptr<FrameProcessorParallelGroupHostObject> FrameProcessorParallelGroupHostObject::create(jsi::Runtime& runtime,
+                                                                                                     const jsi::Value& stages) {
+  std::vector<Stage> result = FrameProcessorPipelineHostObject::parseStages(runtime, stages, "createParallelGroup");
+  for (size_t i = 0; i < result.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      if (result[i].plugin == result[j].plugin) {
+        // A Plugin instance is not expected to be called concurrently with itself
+        throw jsi::JSError(runtime, "createParallelGroup: Stage #" + std::to_string(i) + " uses the same Plugin as stage #" +
+                                        std::to_string(j) + "! Use separate Plugin instances instead.");
+      }
+    }
+  }
+  return std::make_shared<FrameProcessorParallelGroupHostObject>(std::move(result));
+}
+
+namespace {
+
+  /**
+   * Holds a reference on the Frame while the Plugins are running on other Threads.
+   */
+  class FrameReference {
+  public:
+    explicit FrameReference(std::shared_ptr<FrameHostObject> frameHostObject)
+        : _frameHostObject(std::move(frameHostObject)), _isRetained(_frameHostObject->retain()) {}
+    ~FrameReference() {
+      if (_isRetained) {
+        _frameHostObject->release();
+      }
+    }
+
+    FrameReference(const FrameReference&) = delete;
+    FrameReference& operator=(const FrameReference&) = delete;
+
+    bool isRetained() const {
+      return _isRetained;
+    }
+
+  private:
+    std::shared_ptr<FrameHostObject> _frameHostObject;
+    bool _isRetained;
+  };
+
+} // namespace
+
+jsi::Value FrameProcessorParallelGroupHostObject::call(jsi::Runtime& runtime,
+                                                       const std::shared_ptr<FrameHostObject>& frameHostObject) const {
+  FrameReference frameReference(frameHostObject);
+  if (!frameReference.isRetained()) {
+    throw jsi::JSError(runtime, "[capture/frame-invalid] Trying to run Frame Processor Plugins on an already closed Frame!");
+  }
+
+  jni::global_ref<JFrame> frame = PlatformFrame::unwrap(*frameHostObject);
+  // Local refs are only valid on the Thread that created them, so results are promoted to global refs on the workers.
+  std::vector<jni::global_ref<jobject>> results(_stages.size());
+  // An error message can be empty, so a failed stage is one that has an error at all.
+  std::vector<std::optional<std::string>> errors(_stages.size());
+
+  // The calling Frame Processor Thread is a Java Thread, and the shared ThreadPool's workers are attached to the JVM
+  // (with the app's ClassLoader) once when they start, see JNI_OnLoad.
+  ThreadPool::getSharedInstance()->parallelFor(_stages.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      try {
+        // Local refs of a worker are only freed when it detaches, so scope them to this call.
+        jni::JniLocalScope localScope(jni::Environment::current(), 8);
+        const Stage& stage = _stages[i];
+        jni::local_ref<jobject> result = stage.plugin->callback(frame, JPluginOptions::getMap(stage.options));
+        results[i] = jni::make_global(result);
+      } catch (const std::exception& exception) {
+        // Plugin threw an error, rethrown on the JS Thread once all Plugins are done.
+        errors[i] = exception.what();
+      } catch (...) {
+        errors[i] = "Unknown error";
+      }
+    }
+  });
+
+  for (size_t i = 0; i < errors.size(); i++) {
+    if (errors[i].has_value()) {
+      throw jsi::JSError(runtime,
+                         "Frame Processor Plugin #" + std::to_string(i) + " of the parallel group threw an error: " + *errors[i]);
+    }
+  }
+
+  ScopedLatencyTimer timer(FrameProcessorTimings::getResultConversionHistogram());
+  jsi::Array array(runtime, results.size());
+  for (size_t i = 0; i < results.size(); i++) {
+    array.setValueAtIndex(runtime, i, JSIJNIConversion::convertJNIObjectToJSIValue(runtime, jni::make_local(results[i])));
+  }
+  return array;
+}
+
+std::vector<jsi::PropNameID> FrameProcessorParallelGroupHostObject::getPropertyNames(jsi::Runtime& runtime) {
+  return jsi::PropNameID::names(runtime, "call");
+}
+
+jsi::Value FrameProcessorParallelGroupHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  auto name = propName.utf8(runtime);
+
+  if (name == "call") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "call"), 1,
+        [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          auto frameHostObject = FrameProcessorPluginHostObject::getFrameHostObject(runtime, arguments[0]);
+          return call(runtime, frameHostObject);
+        });
+  }
+
+  return jsi::Value::undefined();
+}
+
+} // namespace vision
@@ -0,0 +1,50 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#pragma once
+
+#include "FrameHostObject.h"
+#include "FrameProcessorPipelineHostObject.h"
+#include <fbjni/fbjni.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A group of independent Frame Processor Plugins that run on a Frame in parallel (`VisionCameraProxy.createParallelGroup(..)`).
+ *
+ * Every Plugin is called on the shared native ThreadPool (and the calling Thread), and the call only returns once all
+ * Plugins are done - so a Frame costs as long as the slowest Plugin instead of the sum of all Plugins.
+ * The Frame is retained while the Plugins are running, and the results are converted to JS in the order of the Plugins.
+ */
+class FrameProcessorParallelGroupHostObject : public jsi::HostObject {
+public:
+  using Stage = FrameProcessorPipelineHostObject::Stage;
+
+public:
+  explicit FrameProcessorParallelGroupHostObject(std::vector<Stage> stages);
+  ~FrameProcessorParallelGroupHostObject();
+
+  /**
+   * Creates a parallel group from an array of Plugins or `{ plugin, options }` objects.
+   * Throws a `jsi::JSError` if the stages are invalid, or if a Plugin is used more than once.
+   */
+  static std::shared_ptr<FrameProcessorParallelGroupHostObject> create(jsi::Runtime& runtime, const jsi::Value& stages);
+
+public:
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
+
+private:
+  jsi::Value call(jsi::Runtime& runtime, const std::shared_ptr<FrameHostObject>& frameHostObject) const;
+
+private:
+  std::vector<Stage> _stages;
+};
+
+} // namespace vision
@@ -0,0 +1,119 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#include "FrameProcessorPipelineHostObject.h"
+#include "JSIJNIConversion.h"
+#include "PlatformFrame.h"
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+static constexpr auto kPreviousResultKey = "previousResult";
+
+FrameProcessorPipelineHostObject::FrameProcessorPipelineHostObject(std::vector<Stage> stages) : _stages(std::move(stages)) {}
+
+FrameProcessorPipelineHostObject::~FrameProcessorPipelineHostObject() {
+  // Hermes GC might destroy HostObjects on an arbitrary Thread which might not be
+  // connected to the JNI environment, so connect to it before releasing the Java Plugins.
+  jni::ThreadScope::WithClassLoader([&] { _stages.clear(); });
+}
+
+std::vector<FrameProcessorPipelineHostObject::Stage>
+FrameProcessorPipelineHostObject::parseStages(jsi::Runtime& runtime, const jsi::Value& stages, const std::string& functionName) {
+  if (!stages.isObject() || !stages.getObject(runtime).isArray(runtime)) {
+    throw jsi::JSError(runtime, functionName + ": First argument needs to be an array of Frame Processor Plugins!");
+  }
+  jsi::Array array = stages.getObject(runtime).getArray(runtime);
+  size_t size = array.size(runtime);
+  if (size == 0) {
+    throw jsi::JSError(runtime, functionName + ": At least one Frame Processor Plugin is required!");
+  }
+
+  std::vector<Stage> result;
+  result.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    jsi::Value item = array.getValueAtIndex(runtime, i);
+    if (!item.isObject()) {
+      throw jsi::JSError(runtime, functionName + ": Stage #" + std::to_string(i) + " is not a Frame Processor Plugin!");
+    }
+    jsi::Object itemObject = item.getObject(runtime);
+
+    Stage stage;
+    if (itemObject.isHostObject<FrameProcessorPluginHostObject>(runtime)) {
+      // plugin
+      stage.plugin = itemObject.getHostObject<FrameProcessorPluginHostObject>(runtime);
+    } else {
+      // { plugin, options }
+      jsi::Value plugin = itemObject.getProperty(runtime, "plugin");
+      if (!plugin.isObject() || !plugin.getObject(runtime).isHostObject<FrameProcessorPluginHostObject>(runtime)) {
+        throw jsi::JSError(runtime, functionName + ": Stage #" + std::to_string(i) + " is not a Frame Processor Plugin!");
+      }
+      stage.plugin = plugin.getObject(runtime).getHostObject<FrameProcessorPluginHostObject>(runtime);
+      // Converted once here, instead of on every Frame
+      stage.options = stage.plugin->getOptions(runtime, itemObject.getProperty(runtime, "options"));
+    }
+    result.push_back(std::move(stage));
+  }
+  return result;
+}
+
+std::shared_ptr<FrameProcessorPipelineHostObject> FrameProcessorPipelineHostObject::create(jsi::Runtime& runtime,
+                                                                                           const jsi::Value& stages) {
+  return std::make_shared<FrameProcessorPipelineHostObject>(parseStages(runtime, stages, "createPipeline"));
+}
+
+static jni::local_ref<JMap<jstring, jobject>> createStageParams(const std::shared_ptr<JPluginOptions>& options,
+                                                               const jni::local_ref<jobject>& previousResult) {
+  using PutAll = void(jni::alias_ref<JMap<jstring, jobject>>);
+  static const auto putAllMethod = JMap<jstring, jobject>::javaClassStatic()->getMethod<PutAll>("putAll");
+  static const auto previousResultKey = jni::make_global(jni::make_jstring(kPreviousResultKey));
+
+  auto params = jni::JHashMap<jstring, jobject>::create();
+  if (options != nullptr) {
+    putAllMethod(params, options->map);
+  }
+  params->put(previousResultKey, previousResult);
+  return params;
+}
+
+jni::local_ref<jobject> FrameProcessorPipelineHostObject::call(const jni::alias_ref<JFrame::javaobject>& frame) const {
+  jni::local_ref<jobject> result = _stages[0].plugin->callback(frame, JPluginOptions::getMap(_stages[0].options));
+  for (size_t i = 1; i < _stages.size(); i++) {
+    // The previous result is passed on natively, without converting it to JS and back
+    const Stage& stage = _stages[i];
+    auto params = createStageParams(stage.options, result);
+    result = stage.plugin->callback(frame, params);
+  }
+  return result;
+}
+
+std::vector<jsi::PropNameID> FrameProcessorPipelineHostObject::getPropertyNames(jsi::Runtime& runtime) {
+  return jsi::PropNameID::names(runtime, "call");
+}
+
+jsi::Value FrameProcessorPipelineHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  auto name = propName.utf8(runtime);
+
+  if (name == "call") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "call"), 1,
+        [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          auto frameHostObject = FrameProcessorPluginHostObject::getFrameHostObject(runtime, arguments[0]);
+          auto result = call(PlatformFrame::unwrap(*frameHostObject));
+
+          // Only the result of the last stage is converted to jsi::Value
+          ScopedLatencyTimer timer(FrameProcessorTimings::getResultConversionHistogram());
+          return JSIJNIConversion::convertJNIObjectToJSIValue(runtime, result);
+        });
+  }
+
+  return jsi::Value::undefined();
+}
+
+} // namespace vision
@@ -0,0 +1,58 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#pragma once
+
+#include "FrameProcessorPluginHostObject.h"
+#include <fbjni/fbjni.h>
+#include <jsi/jsi.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A chain of Frame Processor Plugins that runs on a Frame in a single call (`VisionCameraProxy.createPipeline(..)`).
+ *
+ * The Frame is unwrapped once, the options of every stage are converted once when the pipeline is created, and every
+ * stage receives the native result of the previous stage as `previousResult` in its options.
+ * Only the result of the last stage is converted to JS.
+ */
+class FrameProcessorPipelineHostObject : public jsi::HostObject {
+public:
+  struct Stage {
+    std::shared_ptr<FrameProcessorPluginHostObject> plugin;
+    std::shared_ptr<JPluginOptions> options;
+  };
+
+public:
+  explicit FrameProcessorPipelineHostObject(std::vector<Stage> stages);
+  ~FrameProcessorPipelineHostObject();
+
+  /**
+   * Creates a pipeline from an array of Plugins or `{ plugin, options }` objects.
+   * Throws a `jsi::JSError` if the stages are invalid.
+   */
+  static std::shared_ptr<FrameProcessorPipelineHostObject> create(jsi::Runtime& runtime, const jsi::Value& stages);
+  /**
+   * Parses an array of Plugins or `{ plugin, options }` objects and converts their options.
+   * Throws a `jsi::JSError` prefixed with `functionName` if the stages are invalid.
+   */
+  static std::vector<Stage> parseStages(jsi::Runtime& runtime, const jsi::Value& stages, const std::string& functionName);
+
+public:
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
+
+private:
+  jni::local_ref<jobject> call(const jni::alias_ref<JFrame::javaobject>& frame) const;
+
+private:
+  std::vector<Stage> _stages;
+};
+
+} // namespace vision
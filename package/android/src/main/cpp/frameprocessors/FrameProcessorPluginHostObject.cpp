@@ -5,6 +5,7 @@
 #include "FrameProcessorPluginHostObject.h"
 #include "FrameHostObject.h"
 #include "JSIJNIConversion.h"
+#include "PlatformFrame.h"
 #include <string>
 #include <vector>
 
@@ -12,18 +13,63 @@ namespace vision {
 
 using namespace facebook;
 
-FrameProcessorPluginHostObject::FrameProcessorPluginHostObject(jni::alias_ref<JFrameProcessorPlugin::javaobject> plugin)
-    : _plugin(make_global(plugin)) {}
+FrameProcessorPluginHostObject::FrameProcessorPluginHostObject(jni::alias_ref<JFrameProcessorPlugin::javaobject> plugin,
+                                                               const std::string& name)
+    : _plugin(make_global(plugin)), _callbackTimings(FrameProcessorTimings::getPluginHistogram(name)) {}
 
 FrameProcessorPluginHostObject::~FrameProcessorPluginHostObject() {
   // Hermes GC might destroy HostObjects on an arbitrary Thread which might not be
   // connected to the JNI environment. To make sure fbjni can properly destroy
   // the Java method, we connect to a JNI environment first.
-  jni::ThreadScope::WithClassLoader([&] { _plugin.reset(); });
+  jni::ThreadScope::WithClassLoader([&] {
+    _plugin.reset();
+    _optionsCache.clear();
+  });
+}
+
+std::shared_ptr<JPluginOptions> FrameProcessorPluginHostObject::convertOptions(jsi::Runtime& runtime, const jsi::Object& options) {
+  // The converted Map is shared by every call(..) with the same options, so Plugins only get a read-only view of it.
+  using UnmodifiableMap = jni::JMap<jstring, jobject>(jni::alias_ref<jni::JMap<jstring, jobject>>);
+  static const auto collectionsClass = jni::findClassStatic("java/util/Collections");
+  static const auto unmodifiableMapMethod = collectionsClass->getStaticMethod<UnmodifiableMap>("unmodifiableMap");
+
+  auto map = JSIJNIConversion::convertJSIObjectToJNIMap(runtime, options);
+  auto readOnlyMap = unmodifiableMapMethod(collectionsClass, map);
+  return std::make_shared<JPluginOptions>(jni::make_global(readOnlyMap));
 }
 
 std::vector<jsi::PropNameID> FrameProcessorPluginHostObject::getPropertyNames(jsi::Runtime& runtime) {
-  return jsi::PropNameID::names(runtime, "call");
+  return jsi::PropNameID::names(runtime, "call", "prepare");
+}
+
+std::shared_ptr<FrameHostObject> FrameProcessorPluginHostObject::getFrameHostObject(jsi::Runtime& runtime, const jsi::Value& value) {
+  auto frameHolder = value.asObject(runtime);
+  if (frameHolder.isHostObject<FrameHostObject>(runtime)) {
+    // User directly passed FrameHostObject
+    return frameHolder.getHostObject<FrameHostObject>(runtime);
+  } else {
+    // User passed a wrapper, e.g. DrawableFrame which contains the FrameHostObject as a hidden property
+    jsi::Object actualFrame = frameHolder.getPropertyAsObject(runtime, "__frame");
+    return actualFrame.asHostObject<FrameHostObject>(runtime);
+  }
+}
+
+std::shared_ptr<JPluginOptions> FrameProcessorPluginHostObject::getOptions(jsi::Runtime& runtime, const jsi::Value& value) {
+  if (!value.isObject()) {
+    return nullptr;
+  }
+  ScopedLatencyTimer timer(FrameProcessorTimings::getArgumentConversionHistogram());
+  jsi::Object optionsObject = value.getObject(runtime);
+  if (optionsObject.isHostObject<PreparedPluginOptions<std::shared_ptr<JPluginOptions>>>(runtime)) {
+    return optionsObject.getHostObject<PreparedPluginOptions<std::shared_ptr<JPluginOptions>>>(runtime)->getOptions();
+  }
+  return _optionsCache.get(runtime, optionsObject, &FrameProcessorPluginHostObject::convertOptions);
+}
+
+jni::local_ref<jobject> FrameProcessorPluginHostObject::callback(const jni::alias_ref<JFrame::javaobject>& frame,
+                                                                 const jni::alias_ref<JMap<jstring, jobject>>& params) const {
+  ScopedLatencyTimer timer(*_callbackTimings);
+  return _plugin->callback(frame, params);
 }
 
 jsi::Value FrameProcessorPluginHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
@@ -34,31 +80,34 @@ jsi::Value FrameProcessorPluginHostObject::get(jsi::Runtime& runtime, const jsi:
         runtime, jsi::PropNameID::forUtf8(runtime, "call"), 2,
         [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
           // Frame is first argument
-          auto frameHolder = arguments[0].asObject(runtime);
-          std::shared_ptr<FrameHostObject> frameHostObject;
-          if (frameHolder.isHostObject<FrameHostObject>(runtime)) {
-            // User directly passed FrameHostObject
-            frameHostObject = frameHolder.getHostObject<FrameHostObject>(runtime);
-          } else {
-            // User passed a wrapper, e.g. DrawableFrame which contains the FrameHostObject as a hidden property
-            jsi::Object actualFrame = frameHolder.getPropertyAsObject(runtime, "__frame");
-            frameHostObject = actualFrame.asHostObject<FrameHostObject>(runtime);
-          }
-          auto frame = frameHostObject->getFrame();
+          auto frameHostObject = getFrameHostObject(runtime, arguments[0]);
+          auto frame = PlatformFrame::unwrap(*frameHostObject);
 
-          // Options are second argument (possibly undefined)
-          local_ref<JMap<jstring, jobject>> options = nullptr;
-          if (count > 1) {
-            options = JSIJNIConversion::convertJSIObjectToJNIMap(runtime, arguments[1].asObject(runtime));
-          }
+          // Options are second argument (possibly undefined), either prepared or converted through the cache
+          std::shared_ptr<JPluginOptions> options = count > 1 ? getOptions(runtime, arguments[1]) : nullptr;
 
           // Call actual plugin
-          auto result = _plugin->callback(frame, options);
+          auto result = callback(frame, JPluginOptions::getMap(options));
 
           // Convert result value to jsi::Value (possibly undefined)
+          ScopedLatencyTimer timer(FrameProcessorTimings::getResultConversionHistogram());
           return JSIJNIConversion::convertJNIObjectToJSIValue(runtime, result);
         });
   }
+  if (name == "prepare") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "prepare"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1 || !arguments[0].isObject()) {
+            throw jsi::JSError(runtime, "FrameProcessorPlugin.prepare(..): The first argument has to be an options object!");
+          }
+          // Converts the options once, the returned handle can be passed to every call(..)
+          auto options = convertOptions(runtime, arguments[0].getObject(runtime));
+          PluginOptions::recordConversion();
+          auto prepared = std::make_shared<PreparedPluginOptions<std::shared_ptr<JPluginOptions>>>(options);
+          return jsi::Object::createFromHostObject(runtime, prepared);
+        });
+  }
 
   return jsi::Value::undefined();
 }
@@ -4,27 +4,72 @@
 
 #pragma once
 
+#include "FrameHostObject.h"
+#include "FrameProcessorTimings.h"
 #include "JFrameProcessorPlugin.h"
+#include "PluginOptionsCache.h"
 #include <fbjni/fbjni.h>
 #include <jsi/jsi.h>
 #include <memory>
+#include <string>
+#include <utility>
 #include <vector>
 
 namespace vision {
 
 using namespace facebook;
 
+/**
+ * Plugin options that have been converted to a Java Map.
+ */
+struct JPluginOptions {
+  explicit JPluginOptions(jni::global_ref<jni::JMap<jstring, jobject>> map) : map(std::move(map)) {}
+  ~JPluginOptions() {
+    // Might be released from the JS GC or a different Thread, so connect to the JNI environment first.
+    jni::ThreadScope::WithClassLoader([&] { map.reset(); });
+  }
+
+  jni::global_ref<jni::JMap<jstring, jobject>> map;
+
+  static jni::alias_ref<jni::JMap<jstring, jobject>> getMap(const std::shared_ptr<JPluginOptions>& options) {
+    if (options == nullptr) {
+      return nullptr;
+    }
+    return options->map;
+  }
+};
+
 class FrameProcessorPluginHostObject : public jsi::HostObject {
 public:
-  explicit FrameProcessorPluginHostObject(jni::alias_ref<JFrameProcessorPlugin::javaobject> plugin);
+  explicit FrameProcessorPluginHostObject(jni::alias_ref<JFrameProcessorPlugin::javaobject> plugin, const std::string& name);
   ~FrameProcessorPluginHostObject();
 
 public:
   std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
   jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
 
+public:
+  /**
+   * Get the FrameHostObject of a Frame, or of a wrapper like `DrawableFrame`.
+   */
+  static std::shared_ptr<FrameHostObject> getFrameHostObject(jsi::Runtime& runtime, const jsi::Value& value);
+  /**
+   * Get the native options of prepared options, or convert them through the cache. Returns `nullptr` if there are no options.
+   */
+  std::shared_ptr<JPluginOptions> getOptions(jsi::Runtime& runtime, const jsi::Value& value);
+  /**
+   * Calls the Java Plugin, and records how long it took.
+   */
+  jni::local_ref<jobject> callback(const jni::alias_ref<JFrame::javaobject>& frame,
+                                   const jni::alias_ref<JMap<jstring, jobject>>& params) const;
+
+private:
+  static std::shared_ptr<JPluginOptions> convertOptions(jsi::Runtime& runtime, const jsi::Object& options);
+
 private:
   jni::global_ref<JFrameProcessorPlugin::javaobject> _plugin;
+  PluginOptionsCache<std::shared_ptr<JPluginOptions>> _optionsCache;
+  std::shared_ptr<LatencyHistogram> _callbackTimings;
 };
 
 } // namespace vision
@@ -12,15 +12,135 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
+#include "ArrayBufferPool.h"
 #include "FrameHostObject.h"
 #include "JFrame.h"
 #include "JSharedArray.h"
+#include "JTypedResult.h"
+#include "ObjectShape.h"
+#include "PlatformFrame.h"
+#include "RuntimeCache.h"
+#include "TypedArray.h"
 
 namespace vision {
 
 using namespace facebook;
 
+using JKeyCache = PropertyKeyCache<jni::global_ref<jstring>>;
+
+static jni::local_ref<jstring> getKey(jsi::Runtime& runtime, const std::string& name) {
+  // Keys are encoded to Java Strings once per Runtime instead of once per object.
+  const auto& key = RuntimeCache<JKeyCache>::get(runtime).get(name, [](const std::string& keyName) {
+    return jni::make_global(jni::make_jstring(keyName));
+  });
+  return jni::make_local(key);
+}
+
+static jni::local_ref<JHashMap<jstring, jobject>> convertShapedObject(jsi::Runtime& runtime, const jsi::Object& object,
+                                                                      const ObjectShape& shape,
+                                                                      const std::vector<jni::local_ref<jstring>>& keys) {
+  jni::local_ref<JHashMap<jstring, jobject>> hashMap = jni::JHashMap<jstring, jobject>::create(static_cast<int>(shape.size()));
+  for (size_t i = 0; i < shape.size(); i++) {
+    jsi::Value item = object.getProperty(runtime, shape.getPropName(i));
+    jni::local_ref<jobject> jniItem = JSIJNIConversion::convertJSIValueToJNIObject(runtime, item);
+    hashMap->put(keys[i], jniItem);
+  }
+  return hashMap;
+}
+
+static jni::local_ref<JArrayList<jobject>> convertJSIArrayToJNIList(jsi::Runtime& runtime, const jsi::Array& array) {
+  size_t size = array.size(runtime);
+  jni::local_ref<JArrayList<jobject>> arrayList = jni::JArrayList<jobject>::create(static_cast<int>(size));
+  if (size == 0) {
+    return arrayList;
+  }
+
+  jsi::Value first = array.getValueAtIndex(runtime, 0);
+  if (size > 1 && first.isObject() && ObjectShape::isPlainObject(runtime, first.getObject(runtime))) {
+    // Homogeneous array of objects (e.g. bounding boxes): all elements that have the same keys as the first one
+    // share its property names and encoded Java keys, instead of enumerating and encoding them for every element.
+    jsi::Object firstObject = first.getObject(runtime);
+    ObjectShape shape(runtime, firstObject);
+    std::vector<jni::local_ref<jstring>> keys;
+    keys.reserve(shape.size());
+    for (size_t i = 0; i < shape.size(); i++) {
+      keys.push_back(getKey(runtime, shape.getName(i)));
+    }
+
+    arrayList->add(convertShapedObject(runtime, firstObject, shape, keys));
+    for (size_t i = 1; i < size; i++) {
+      jsi::Value item = array.getValueAtIndex(runtime, i);
+      if (item.isObject()) {
+        jsi::Object itemObject = item.getObject(runtime);
+        if (ObjectShape::isPlainObject(runtime, itemObject) && shape.matches(runtime, itemObject)) {
+          arrayList->add(convertShapedObject(runtime, itemObject, shape, keys));
+          continue;
+        }
+      }
+      arrayList->add(JSIJNIConversion::convertJSIValueToJNIObject(runtime, item));
+    }
+    return arrayList;
+  }
+
+  arrayList->add(JSIJNIConversion::convertJSIValueToJNIObject(runtime, first));
+  for (size_t i = 1; i < size; i++) {
+    jsi::Value item = array.getValueAtIndex(runtime, i);
+    jni::local_ref<jobject> jniItem = JSIJNIConversion::convertJSIValueToJNIObject(runtime, item);
+    arrayList->add(jniItem);
+  }
+  return arrayList;
+}
+
+static jni::local_ref<jobject> convertTypedArrayToJNIArray(const TypedArrayView& view) {
+  // A single copy from the JS heap into the Java array, no element is boxed
+  jsize length = static_cast<jsize>(view.length);
+  switch (view.kind) {
+    case TypedArrayKind::Int8:
+    case TypedArrayKind::Uint8:
+    case TypedArrayKind::Uint8Clamped: {
+      auto array = jni::JArrayByte::newArray(length);
+      array->setRegion(0, length, reinterpret_cast<const jbyte*>(view.data));
+      return array;
+    }
+    case TypedArrayKind::Int16:
+    case TypedArrayKind::Uint16: {
+      auto array = jni::JArrayShort::newArray(length);
+      array->setRegion(0, length, reinterpret_cast<const jshort*>(view.data));
+      return array;
+    }
+    case TypedArrayKind::Int32:
+    case TypedArrayKind::Uint32: {
+      auto array = jni::JArrayInt::newArray(length);
+      array->setRegion(0, length, reinterpret_cast<const jint*>(view.data));
+      return array;
+    }
+    case TypedArrayKind::Float32: {
+      auto array = jni::JArrayFloat::newArray(length);
+      array->setRegion(0, length, reinterpret_cast<const jfloat*>(view.data));
+      return array;
+    }
+    case TypedArrayKind::Float64: {
+      auto array = jni::JArrayDouble::newArray(length);
+      array->setRegion(0, length, reinterpret_cast<const jdouble*>(view.data));
+      return array;
+    }
+  }
+  throw std::runtime_error("Unsupported TypedArray kind!");
+}
+
+template <typename TArray, typename TElement>
+static jsi::Value convertJNIArrayToTypedArray(jsi::Runtime& runtime, const jni::local_ref<jobject>& object, TypedArrayKind kind) {
+  auto array = static_ref_cast<TArray>(object);
+  size_t length = array->size();
+  // A single copy from the Java array into a pooled buffer, no element is boxed
+  auto buffer = ArrayBufferPool::getSharedInstance()->acquire(length * sizeof(TElement));
+  array->getRegion(0, static_cast<jsize>(length), reinterpret_cast<TElement*>(buffer->data()));
+  jsi::ArrayBuffer arrayBuffer(runtime, std::move(buffer));
+  return TypedArrays::create(runtime, kind, arrayBuffer, 0, length);
+}
+
 jni::local_ref<jobject> JSIJNIConversion::convertJSIValueToJNIObject(jsi::Runtime& runtime, const jsi::Value& value) {
   if (value.isNull() || value.isUndefined()) {
     // null
@@ -49,14 +169,7 @@ jni::local_ref<jobject> JSIJNIConversion::convertJSIValueToJNIObject(jsi::Runtim
       // List<Object>
 
       jsi::Array array = valueAsObject.getArray(runtime);
-      size_t size = array.size(runtime);
-      jni::local_ref<JArrayList<jobject>> arrayList = jni::JArrayList<jobject>::create(static_cast<int>(size));
-      for (size_t i = 0; i < size; i++) {
-        jsi::Value item = array.getValueAtIndex(runtime, i);
-        jni::local_ref<jobject> jniItem = convertJSIValueToJNIObject(runtime, item);
-        arrayList->add(jniItem);
-      }
-      return arrayList;
+      return convertJSIArrayToJNIList(runtime, array);
     } else if (valueAsObject.isArrayBuffer(runtime)) {
       // ArrayBuffer/TypedArray
 
@@ -69,26 +182,20 @@ jni::local_ref<jobject> JSIJNIConversion::convertJSIValueToJNIObject(jsi::Runtim
         // Frame
 
         auto frameHostObject = valueAsObject.getHostObject<FrameHostObject>(runtime);
-        return jni::make_local(frameHostObject->getFrame());
+        return jni::make_local(PlatformFrame::unwrap(*frameHostObject));
 
       } else {
         throw std::runtime_error("The given HostObject is not supported by a Frame Processor Plugin.");
       }
 
+    } else if (auto typedArray = TypedArrays::getView(runtime, valueAsObject)) {
+      // TypedArray -> byte[]/short[]/int[]/float[]/double[]
+
+      return convertTypedArrayToJNIArray(*typedArray);
     } else {
       // Map<String, Object>
 
-      jsi::Array propertyNames = valueAsObject.getPropertyNames(runtime);
-      size_t size = propertyNames.size(runtime);
-      jni::local_ref<JHashMap<jstring, jobject>> hashMap = jni::JHashMap<jstring, jobject>::create();
-      for (size_t i = 0; i < size; i++) {
-        jsi::String propName = propertyNames.getValueAtIndex(runtime, i).asString(runtime);
-        jsi::Value item = valueAsObject.getProperty(runtime, propName);
-        jni::local_ref<jstring> key = jni::make_jstring(propName.utf8(runtime));
-        jni::local_ref<jobject> jniItem = convertJSIValueToJNIObject(runtime, item);
-        hashMap->put(key, jniItem);
-      }
-      return hashMap;
+      return convertJSIObjectToJNIMap(runtime, valueAsObject);
     }
   } else {
     auto stringRepresentation = value.toString(runtime).utf8(runtime);
@@ -104,8 +211,8 @@ jni::local_ref<jni::JMap<jstring, jobject>> JSIJNIConversion::convertJSIObjectTo
   for (size_t i = 0; i < size; i++) {
     jsi::String propName = propertyNames.getValueAtIndex(runtime, i).asString(runtime);
     jsi::Value value = object.getProperty(runtime, propName);
-    jni::local_ref<jstring> key = jni::make_jstring(propName.utf8(runtime));
     jni::local_ref<jobject> jniValue = convertJSIValueToJNIObject(runtime, value);
+    jni::local_ref<jstring> key = getKey(runtime, propName.utf8(runtime));
     hashMap->put(key, jniValue);
   }
 
@@ -117,6 +224,11 @@ jsi::Value JSIJNIConversion::convertJNIObjectToJSIValue(jsi::Runtime& runtime, c
     // null
 
     return jsi::Value::undefined();
+  } else if (object->isInstanceOf(JTypedResult::javaClassStatic())) {
+    // TypedResult - checked first since it is the fast path for large results
+    auto typedResult = static_ref_cast<JTypedResult::javaobject>(object);
+
+    return typedResult->cthis()->toJSIValue(runtime);
   } else if (object->isInstanceOf(jni::JBoolean::javaClassStatic())) {
     // Boolean
 
@@ -164,12 +276,32 @@ jsi::Value JSIJNIConversion::convertJNIObjectToJSIValue(jsi::Runtime& runtime, c
       result.setProperty(runtime, key.c_str(), jsiValue);
     }
     return result;
+  } else if (object->isInstanceOf(jni::JArrayFloat::javaClassStatic())) {
+    // float[]
+
+    return convertJNIArrayToTypedArray<jni::JArrayFloat, jfloat>(runtime, object, TypedArrayKind::Float32);
+  } else if (object->isInstanceOf(jni::JArrayInt::javaClassStatic())) {
+    // int[]
+
+    return convertJNIArrayToTypedArray<jni::JArrayInt, jint>(runtime, object, TypedArrayKind::Int32);
+  } else if (object->isInstanceOf(jni::JArrayDouble::javaClassStatic())) {
+    // double[]
+
+    return convertJNIArrayToTypedArray<jni::JArrayDouble, jdouble>(runtime, object, TypedArrayKind::Float64);
+  } else if (object->isInstanceOf(jni::JArrayByte::javaClassStatic())) {
+    // byte[]
+
+    return convertJNIArrayToTypedArray<jni::JArrayByte, jbyte>(runtime, object, TypedArrayKind::Uint8);
+  } else if (object->isInstanceOf(jni::JArrayShort::javaClassStatic())) {
+    // short[]
+
+    return convertJNIArrayToTypedArray<jni::JArrayShort, jshort>(runtime, object, TypedArrayKind::Int16);
   } else if (object->isInstanceOf(JFrame::javaClassStatic())) {
     // Frame
     auto frame = static_ref_cast<JFrame>(object);
 
     // box into HostObject
-    auto hostObject = std::make_shared<FrameHostObject>(frame);
+    auto hostObject = std::make_shared<FrameHostObject>(std::make_shared<PlatformFrame>(frame));
     return jsi::Object::createFromHostObject(runtime, hostObject);
   } else if (object->isInstanceOf(JSharedArray::javaClassStatic())) {
     // SharedArray
@@ -0,0 +1,130 @@
+//
+// Created by Marc Rousavy on 16.10.26.
+//
+
+#include "PlatformFrame.h"
+
+#include <fbjni/fbjni.h>
+#include <jni.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include <android/hardware_buffer.h>
+#include <android/hardware_buffer_jni.h>
+
+namespace vision {
+
+using namespace facebook;
+
+PlatformFrame::PlatformFrame(const jni::alias_ref<JFrame::javaobject>& frame, const FrameMetadata& metadata)
+    : _frame(make_global(frame)), _metadata(metadata), _isOwnedByFrameProcessor(true) {}
+
+PlatformFrame::PlatformFrame(const jni::alias_ref<JFrame::javaobject>& frame)
+    : _frame(make_global(frame)), _metadata(frame->getMetadata()), _isOwnedByFrameProcessor(false) {}
+
+PlatformFrame::~PlatformFrame() {
+  // Hermes GC might destroy HostObjects (and with them this Frame) on an arbitrary Thread which might not be
+  // connected to the JNI environment. To make sure fbjni can properly destroy the Java reference, we connect
+  // to a JNI environment first.
+  jni::ThreadScope::WithClassLoader([&] { _frame = nullptr; });
+}
+
+jni::global_ref<JFrame> PlatformFrame::unwrap(const FrameHostObject& frameHostObject) {
+  auto platformFrame = std::dynamic_pointer_cast<PlatformFrame>(frameHostObject.getNativeFrame());
+  if (platformFrame == nullptr) {
+    throw std::runtime_error("This Frame is not a Camera Frame, and cannot be passed to native Frame Processor Plugins!");
+  }
+  return platformFrame->getFrame();
+}
+
+#if __ANDROID_API__ >= 26
+/**
+ * Takes ownership of an acquired and locked HardwareBuffer, and unlocks and releases it once the last reference is gone.
+ */
+static std::shared_ptr<void> createHardwareBufferLock(AHardwareBuffer* hardwareBuffer) {
+  return std::shared_ptr<void>(hardwareBuffer, [](void* pointer) {
+    auto lockedBuffer = static_cast<AHardwareBuffer*>(pointer);
+    AHardwareBuffer_unlock(lockedBuffer, nullptr);
+    AHardwareBuffer_release(lockedBuffer);
+  });
+}
+#endif
+
+std::vector<FramePlane> PlatformFrame::lockPlanes(std::shared_ptr<void>& lock) {
+#if __ANDROID_API__ >= 29
+  AHardwareBuffer* hardwareBuffer = _frame->getHardwareBuffer();
+  AHardwareBuffer_acquire(hardwareBuffer);
+
+  AHardwareBuffer_Desc bufferDescription;
+  AHardwareBuffer_describe(hardwareBuffer, &bufferDescription);
+
+  // Get CPU access to all planes of the HardwareBuffer
+  AHardwareBuffer_Planes lockedPlanes;
+  int result = AHardwareBuffer_lockPlanes(hardwareBuffer, AHARDWAREBUFFER_USAGE_CPU_READ_MASK, -1, nullptr, &lockedPlanes);
+  if (result != 0) {
+    AHardwareBuffer_release(hardwareBuffer);
+    throw std::runtime_error("Failed to lock HardwareBuffer planes for reading!");
+  }
+  lock = createHardwareBufferLock(hardwareBuffer);
+
+  std::vector<FramePlane> planes;
+  planes.reserve(lockedPlanes.planeCount);
+  for (uint32_t i = 0; i < lockedPlanes.planeCount; i++) {
+    const AHardwareBuffer_Plane& lockedPlane = lockedPlanes.planes[i];
+    // Chroma planes of YUV 4:2:0 are subsampled by two in both dimensions
+    bool isChromaPlane = lockedPlanes.planeCount == 3 && i > 0;
+    FramePlane plane;
+    plane.data = static_cast<uint8_t*>(lockedPlane.data);
+    plane.width = static_cast<int32_t>(isChromaPlane ? (bufferDescription.width + 1) / 2 : bufferDescription.width);
+    plane.height = static_cast<int32_t>(isChromaPlane ? (bufferDescription.height + 1) / 2 : bufferDescription.height);
+    plane.bytesPerRow = static_cast<int32_t>(lockedPlane.rowStride);
+    plane.pixelStride = static_cast<int32_t>(lockedPlane.pixelStride);
+    planes.push_back(plane);
+  }
+  return planes;
+#else
+  throw std::runtime_error("Frame.getPlanes(), Frame.resize() and Frame.toArrayBuffer({ pixelFormat }) are only available if "
+                           "minSdkVersion is set to 29 or higher!");
+#endif
+}
+
+uint8_t* PlatformFrame::lockBuffer(std::shared_ptr<void>& lock, size_t& size) {
+#if __ANDROID_API__ >= 26
+  AHardwareBuffer* hardwareBuffer = _frame->getHardwareBuffer();
+  AHardwareBuffer_acquire(hardwareBuffer);
+
+  AHardwareBuffer_Desc bufferDescription;
+  AHardwareBuffer_describe(hardwareBuffer, &bufferDescription);
+
+  // Get CPU access to the HardwareBuffer (&buffer is a virtual temporary address)
+  void* buffer;
+  int result = AHardwareBuffer_lock(hardwareBuffer, AHARDWAREBUFFER_USAGE_CPU_READ_MASK, -1, nullptr, &buffer);
+  if (result != 0) {
+    AHardwareBuffer_release(hardwareBuffer);
+    throw std::runtime_error("Failed to lock HardwareBuffer for reading!");
+  }
+  lock = createHardwareBufferLock(hardwareBuffer);
+  size = bufferDescription.height * bufferDescription.stride;
+  return static_cast<uint8_t*>(buffer);
+#else
+  throw std::runtime_error("Frame.toArrayBuffer() is only available if minSdkVersion is set to 26 or higher!");
+#endif
+}
+
+NativeBuffer PlatformFrame::getNativeBuffer() {
+#if __ANDROID_API__ >= 26
+  AHardwareBuffer* hardwareBuffer = _frame->getHardwareBuffer();
+  AHardwareBuffer_acquire(hardwareBuffer);
+  NativeBuffer buffer;
+  buffer.pointer = reinterpret_cast<uintptr_t>(hardwareBuffer);
+  buffer.release = [hardwareBuffer]() { AHardwareBuffer_release(hardwareBuffer); };
+  return buffer;
+#else
+  throw std::runtime_error("Cannot get Platform Buffer - getNativeBuffer() requires HardwareBuffers, which are "
+                           "only available on Android API 26 or above. Set your app's minSdk version to 26 and try again.");
+#endif
+}
+
+} // namespace vision
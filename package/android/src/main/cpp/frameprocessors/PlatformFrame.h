@@ -0,0 +1,78 @@
+//
+// Created by Marc Rousavy on 16.10.26.
+//
+
+#pragma once
+
+#include <fbjni/fbjni.h>
+#include <jni.h>
+#include <memory>
+#include <vector>
+
+#include "FrameHostObject.h"
+#include "FrameMetadata.h"
+#include "JFrame.h"
+#include "NativeFrame.h"
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * The `NativeFrame` of a Camera Frame on Android, backed by the Java `Frame` and its `HardwareBuffer`.
+ */
+class PlatformFrame : public NativeFrame {
+public:
+  /**
+   * Wraps the Frame of a Frame Processor call, which stays valid as long as the FrameHostObject's ref-count.
+   */
+  explicit PlatformFrame(const jni::alias_ref<JFrame::javaobject>& frame, const FrameMetadata& metadata);
+  /**
+   * Wraps a Frame that is owned by someone else (e.g. returned by a Plugin), which might be closed at any time.
+   */
+  explicit PlatformFrame(const jni::alias_ref<JFrame::javaobject>& frame);
+  ~PlatformFrame() override;
+
+public:
+  const FrameMetadata& getMetadata() const override {
+    return _metadata;
+  }
+  bool getIsValid() const override {
+    // Frames of a Frame Processor call are tracked by the FrameHostObject's ref-count, without a JNI call per access.
+    return _isOwnedByFrameProcessor || _frame->getIsValid();
+  }
+  std::vector<FramePlane> lockPlanes(std::shared_ptr<void>& lock) override;
+  uint8_t* lockBuffer(std::shared_ptr<void>& lock, size_t& size) override;
+  NativeBuffer getNativeBuffer() override;
+  // CameraX delivers RGB Frames as RGBA, and YUV Frames in full range.
+  PixelLayout getPackedLayout() const override {
+    return PixelLayout::RGBA;
+  }
+  bool getIsFullRange() const override {
+    return true;
+  }
+  void retain() override {
+    _frame->incrementRefCount();
+  }
+  void release() override {
+    _frame->decrementRefCount();
+  }
+
+public:
+  inline const jni::global_ref<JFrame>& getFrame() const noexcept {
+    return _frame;
+  }
+
+  /**
+   * Get the Java Frame of the given Frame Host Object.
+   * Throws if the Frame is not a Camera Frame (e.g. a `SyntheticFrame`), which cannot be passed to Java.
+   */
+  static jni::global_ref<JFrame> unwrap(const FrameHostObject& frameHostObject);
+
+private:
+  jni::global_ref<JFrame> _frame;
+  FrameMetadata _metadata;
+  bool _isOwnedByFrameProcessor;
+};
+
+} // namespace vision
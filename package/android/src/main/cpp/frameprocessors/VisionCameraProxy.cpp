@@ -12,7 +12,11 @@
 #include <android/log.h>
 #include <fbjni/fbjni.h>
 
+#include "FrameProcessorParallelGroupHostObject.h"
+#include "FrameProcessorPipelineHostObject.h"
 #include "FrameProcessorPluginHostObject.h"
+#include "NativeStateHostObject.h"
+#include "VisionCameraStats.h"
 
 #include <memory>
 #include <string>
@@ -38,15 +42,20 @@ VisionCameraProxy::~VisionCameraProxy() {
 }
 
 std::vector<jsi::PropNameID> VisionCameraProxy::getPropertyNames(jsi::Runtime& runtime) {
-  return jsi::PropNameID::names(runtime, "setFrameProcessor", "removeFrameProcessor", "initFrameProcessorPlugin", "workletContext");
+  return jsi::PropNameID::names(runtime, "setFrameProcessor", "removeFrameProcessor", "initFrameProcessorPlugin", "createPipeline",
+                                "createParallelGroup", "createNativeState", "getStats", "workletContext");
 }
 
 void VisionCameraProxy::setFrameProcessor(int viewTag, jsi::Runtime& runtime, const std::shared_ptr<jsi::Function>& function) {
+  // The Frame Processor owns the NativeState slots it captures, they have to exist before its first Frame arrives.
+  auto nativeStateNames = NativeStateHostObject::getCapturedNames(runtime, *function);
+  _javaProxy->cthis()->getNativeStates()->setFrameProcessorStates(viewTag, nativeStateNames);
   _javaProxy->cthis()->setFrameProcessor(viewTag, runtime, function);
 }
 
 void VisionCameraProxy::removeFrameProcessor(int viewTag) {
   _javaProxy->cthis()->removeFrameProcessor(viewTag);
+  _javaProxy->cthis()->getNativeStates()->removeFrameProcessorStates(viewTag);
 }
 
 jsi::Value VisionCameraProxy::initFrameProcessorPlugin(jsi::Runtime& runtime, const std::string& name, const jsi::Object& jsOptions) {
@@ -57,7 +66,7 @@ jsi::Value VisionCameraProxy::initFrameProcessorPlugin(jsi::Runtime& runtime, co
     return jsi::Value::undefined();
   }
 
-  auto pluginHostObject = std::make_shared<FrameProcessorPluginHostObject>(plugin);
+  auto pluginHostObject = std::make_shared<FrameProcessorPluginHostObject>(plugin, name);
   return jsi::Object::createFromHostObject(runtime, pluginHostObject);
 }
 
@@ -94,6 +103,48 @@ jsi::Value VisionCameraProxy::get(jsi::Runtime& runtime, const jsi::PropNameID&
 
           return this->initFrameProcessorPlugin(runtime, pluginName, options);
         });
+  } else if (name == "createPipeline") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createPipeline"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1) {
+            throw jsi::JSError(runtime, "createPipeline: First argument needs to be an array of Frame Processor Plugins!");
+          }
+          auto pipeline = FrameProcessorPipelineHostObject::create(runtime, arguments[0]);
+          return jsi::Object::createFromHostObject(runtime, pipeline);
+        });
+  } else if (name == "createParallelGroup") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createParallelGroup"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1) {
+            throw jsi::JSError(runtime, "createParallelGroup: First argument needs to be an array of Frame Processor Plugins!");
+          }
+          auto group = FrameProcessorParallelGroupHostObject::create(runtime, arguments[0]);
+          return jsi::Object::createFromHostObject(runtime, group);
+        });
+  } else if (name == "createNativeState") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createNativeState"), 1,
+        [this](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1 || !arguments[0].isString()) {
+            throw jsi::JSError(runtime, "createNativeState: First argument needs to be a string (name)!");
+          }
+          auto name = arguments[0].asString(runtime).utf8(runtime);
+          auto handle = std::make_shared<NativeStateHostObject>(_javaProxy->cthis()->getNativeStates(), name);
+          return jsi::Object::createFromHostObject(runtime, handle);
+        });
+  } else if (name == "getStats") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "getStats"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          bool resetTimings = false;
+          if (count > 0 && arguments[0].isObject()) {
+            jsi::Value resetTimingsValue = arguments[0].getObject(runtime).getProperty(runtime, "resetTimings");
+            resetTimings = resetTimingsValue.isBool() && resetTimingsValue.getBool();
+          }
+          return VisionCameraStats::getStats(runtime, resetTimings);
+        });
   } else if (name == "workletContext") {
 #if VISION_CAMERA_ENABLE_FRAME_PROCESSORS
     std::shared_ptr<RNWorklet::JsiWorkletContext> context = _javaProxy->cthis()->getWorkletContext();
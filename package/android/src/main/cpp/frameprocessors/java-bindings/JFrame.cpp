@@ -61,6 +61,22 @@ int JFrame::getBytesPerRow() const {
   return getBytesPerRowMethod(self());
 }
 
+FrameMetadata JFrame::getMetadata() const {
+  static const auto getOrientationOrdinalMethod = JOrientation::javaClassStatic()->getMethod<jint()>("ordinal");
+  static const auto getPixelFormatOrdinalMethod = JPixelFormat::javaClassStatic()->getMethod<jint()>("ordinal");
+
+  FrameMetadata metadata;
+  metadata.width = getWidth();
+  metadata.height = getHeight();
+  metadata.bytesPerRow = getBytesPerRow();
+  metadata.planesCount = getPlanesCount();
+  metadata.timestamp = static_cast<double>(getTimestamp());
+  metadata.orientation = static_cast<FrameOrientation>(getOrientationOrdinalMethod(getOrientation()));
+  metadata.pixelFormat = static_cast<FramePixelFormat>(getPixelFormatOrdinalMethod(getPixelFormat()));
+  metadata.isMirrored = getIsMirrored();
+  return metadata;
+}
+
 #if __ANDROID_API__ >= 26
 AHardwareBuffer* JFrame::getHardwareBuffer() const {
   static const auto getHardwareBufferMethod = getClass()->getMethod<jobject()>("getHardwareBufferBoxed");
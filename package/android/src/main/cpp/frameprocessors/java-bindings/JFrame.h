@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include "FrameMetadata.h"
 #include "JOrientation.h"
 #include "JPixelFormat.h"
 #include <fbjni/fbjni.h>
@@ -29,6 +30,11 @@ public:
   jlong getTimestamp() const;
   local_ref<JOrientation> getOrientation() const;
   local_ref<JPixelFormat> getPixelFormat() const;
+  /**
+   * Reads all metadata of this Frame through individual JNI calls.
+   * Prefer passing the metadata to C++ in a single call where possible (see `FrameProcessor.call`).
+   */
+  FrameMetadata getMetadata() const;
 #if __ANDROID_API__ >= 26
   AHardwareBuffer* getHardwareBuffer() const;
 #endif
@@ -8,7 +8,11 @@
 #include <fbjni/fbjni.h>
 #include <jni.h>
 
+#include "FrameProcessorTimings.h"
+#include "FrameScope.h"
 #include "JFrame.h"
+#include "PlatformFrame.h"
+#include <ctime>
 #include <utility>
 
 namespace vision {
@@ -35,6 +39,11 @@ TSelf JFrameProcessor::create(const std::shared_ptr<RNWorklet::JsiWorklet>& work
 void JFrameProcessor::callWithFrameHostObject(const std::shared_ptr<FrameHostObject>& frameHostObject) const {
   // Call the Frame Processor on the Worklet Runtime
   jsi::Runtime& runtime = _workletContext->getWorkletRuntime();
+  ScopedLatencyTimer timer(FrameProcessorTimings::getFrameProcessorHistogram());
+
+  // Use a jsi::Scope to indicate that all values allocated in a Frame Processor shall be picked up by GC if possible,
+  // and provide the per-Frame scratch arena to plugins.
+  FrameScope scope(runtime);
 
   // Wrap HostObject as JSI Value
   auto argument = jsi::Object::createFromHostObject(runtime, frameHostObject);
@@ -44,10 +53,40 @@ void JFrameProcessor::callWithFrameHostObject(const std::shared_ptr<FrameHostObj
   _workletInvoker->call(runtime, jsi::Value::undefined(), &jsValue, 1);
 }
 
-void JFrameProcessor::call(jni::alias_ref<JFrame::javaobject> frame) {
+static int64_t getQueueingDelayNs(int64_t timestampNs, bool isTimestampRealtime) {
+  // SENSOR_INFO_TIMESTAMP_SOURCE_REALTIME timestamps are in the BOOTTIME time base, UNKNOWN ones in the MONOTONIC time base.
+  timespec now;
+  if (clock_gettime(isTimestampRealtime ? CLOCK_BOOTTIME : CLOCK_MONOTONIC, &now) != 0) {
+    return -1;
+  }
+  return static_cast<int64_t>(now.tv_sec) * 1'000'000'000 + now.tv_nsec - timestampNs;
+}
+
+void JFrameProcessor::call(jni::alias_ref<JFrame::javaobject> frame, jint width, jint height, jint bytesPerRow, jint planesCount,
+                          jlong timestamp, jboolean isTimestampRealtime, jlong maxFrameDurationNs, jint orientation, jint pixelFormat,
+                          jboolean isMirrored) {
+  FrameMetadata metadata;
+  metadata.width = width;
+  metadata.height = height;
+  metadata.bytesPerRow = bytesPerRow;
+  metadata.planesCount = planesCount;
+  metadata.timestamp = static_cast<double>(timestamp);
+  metadata.orientation = static_cast<FrameOrientation>(orientation);
+  metadata.pixelFormat = static_cast<FramePixelFormat>(pixelFormat);
+  metadata.isMirrored = isMirrored;
+
+  _sequenceTracker.onFrame(timestamp, getQueueingDelayNs(timestamp, isTimestampRealtime), maxFrameDurationNs);
+
   // Create the Frame Host Object wrapping the internal Frame
-  auto frameHostObject = std::make_shared<FrameHostObject>(frame);
-  callWithFrameHostObject(frameHostObject);
+  auto frameHostObject = std::make_shared<FrameHostObject>(std::make_shared<PlatformFrame>(frame, metadata));
+  try {
+    callWithFrameHostObject(frameHostObject);
+  } catch (...) {
+    frameHostObject->onFrameProcessorFinished();
+    throw;
+  }
+  // The pipeline closes the Frame after this returns unless JS incremented its ref-count
+  frameHostObject->onFrameProcessorFinished();
 }
 
 } // namespace vision
@@ -15,6 +15,7 @@
 #include <react-native-worklets-core/WKTJsiWorklet.h>
 
 #include "FrameHostObject.h"
+#include "FrameSequenceTracker.h"
 #include "JFrame.h"
 
 namespace vision {
@@ -30,9 +31,10 @@ public:
 
 public:
   /**
-   * Call the JS Frame Processor.
+   * Call the JS Frame Processor with the given Frame and a snapshot of its metadata.
    */
-  void call(alias_ref<JFrame::javaobject> frame);
+  void call(alias_ref<JFrame::javaobject> frame, jint width, jint height, jint bytesPerRow, jint planesCount, jlong timestamp,
+            jboolean isTimestampRealtime, jlong maxFrameDurationNs, jint orientation, jint pixelFormat, jboolean isMirrored);
 
 private:
   // Private constructor. Use `create(..)` to create new instances.
@@ -45,6 +47,7 @@ private:
   friend HybridBase;
   std::shared_ptr<RNWorklet::WorkletInvoker> _workletInvoker;
   std::shared_ptr<RNWorklet::JsiWorkletContext> _workletContext;
+  FrameSequenceTracker _sequenceTracker;
 };
 
 } // namespace vision
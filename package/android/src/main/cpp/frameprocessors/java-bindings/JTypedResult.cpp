@@ -0,0 +1,57 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#include "JTypedResult.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace vision {
+
+using namespace facebook;
+
+JTypedResult::JTypedResult(std::shared_ptr<TypedResultSchema> schema) : _result(std::move(schema)) {}
+
+void JTypedResult::registerNatives() {
+  registerHybrid({
+      makeNativeMethod("initHybrid", JTypedResult::initHybrid),
+      makeNativeMethod("setCount", JTypedResult::setCount),
+      makeNativeMethod("getCount", JTypedResult::getCount),
+      makeNativeMethod("getFieldByteBuffer", JTypedResult::getFieldByteBuffer),
+  });
+}
+
+jsi::Value JTypedResult::toJSIValue(jsi::Runtime& runtime) const {
+  return _result.toJSIValue(runtime);
+}
+
+void JTypedResult::setCount(jint count) {
+  if (count < 0) {
+    throw std::runtime_error("TypedResult: count cannot be negative!");
+  }
+  _result.setCount(static_cast<size_t>(count));
+}
+
+jint JTypedResult::getCount() {
+  return static_cast<jint>(_result.getCount());
+}
+
+jni::local_ref<jni::JByteBuffer> JTypedResult::getFieldByteBuffer(jni::alias_ref<jstring> field, jint dataType) {
+  size_t index = _result.getSchema().getFieldIndex(field->toStdString());
+  const TypedResultField& schemaField = _result.getSchema().getField(index);
+  if (schemaField.dataType != JTypedResultSchema::getDataType(dataType)) {
+    throw std::runtime_error("TypedResult: Field \"" + schemaField.name + "\" has a different data type!");
+  }
+  // Wraps the pooled memory without copying, it stays alive as long as this TypedResult.
+  return jni::JByteBuffer::wrapBytes(_result.getFieldData(index), _result.getFieldByteSize(index));
+}
+
+jni::local_ref<JTypedResult::jhybriddata> JTypedResult::initHybrid(jni::alias_ref<jhybridobject>,
+                                                                   jni::alias_ref<JTypedResultSchema::javaobject> schema) {
+  return makeCxxInstance(schema->cthis()->getSchema());
+}
+
+} // namespace vision
@@ -0,0 +1,41 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#pragma once
+
+#include "JTypedResultSchema.h"
+#include "TypedResult.h"
+#include <fbjni/ByteBuffer.h>
+#include <fbjni/fbjni.h>
+#include <jni.h>
+#include <jsi/jsi.h>
+
+namespace vision {
+
+using namespace facebook;
+
+class JTypedResult : public jni::HybridClass<JTypedResult> {
+public:
+  static auto constexpr kJavaDescriptor = "Lcom/mrousavy/camera/frameprocessors/TypedResult;";
+  static void registerNatives();
+
+public:
+  jsi::Value toJSIValue(jsi::Runtime& runtime) const;
+
+private:
+  void setCount(jint count);
+  jint getCount();
+  jni::local_ref<jni::JByteBuffer> getFieldByteBuffer(jni::alias_ref<jstring> field, jint dataType);
+
+private:
+  friend HybridBase;
+  TypedResult _result;
+
+private:
+  explicit JTypedResult(std::shared_ptr<TypedResultSchema> schema);
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jhybridobject> javaThis,
+                                                jni::alias_ref<JTypedResultSchema::javaobject> schema);
+};
+
+} // namespace vision
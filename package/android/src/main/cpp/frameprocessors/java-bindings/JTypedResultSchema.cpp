@@ -0,0 +1,74 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#include "JTypedResultSchema.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+JTypedResultSchema::JTypedResultSchema(size_t capacity) : _schema(std::make_shared<TypedResultSchema>(capacity)) {}
+
+void JTypedResultSchema::registerNatives() {
+  registerHybrid({
+      makeNativeMethod("initHybrid", JTypedResultSchema::initHybrid),
+      makeNativeMethod("getCapacity", JTypedResultSchema::getCapacity),
+      makeNativeMethod("addArray", JTypedResultSchema::addArray),
+      makeNativeMethod("addTensor", JTypedResultSchema::addTensor),
+  });
+}
+
+const std::shared_ptr<TypedResultSchema>& JTypedResultSchema::getSchema() const {
+  return _schema;
+}
+
+TypedResultDataType JTypedResultSchema::getDataType(jint dataType) {
+  switch (dataType) {
+    case 0:
+      return TypedResultDataType::Float32;
+    case 1:
+      return TypedResultDataType::Int32;
+    default:
+      throw std::runtime_error("Invalid TypedResultSchema data type: " + std::to_string(dataType));
+  }
+}
+
+jint JTypedResultSchema::getCapacity() {
+  return static_cast<jint>(_schema->getCapacity());
+}
+
+void JTypedResultSchema::addArray(jni::alias_ref<jstring> name, jint dataType, jint componentsCount) {
+  if (componentsCount < 0) {
+    throw std::runtime_error("TypedResultSchema: componentsCount cannot be negative!");
+  }
+  _schema->addArray(name->toStdString(), getDataType(dataType), static_cast<size_t>(componentsCount));
+}
+
+void JTypedResultSchema::addTensor(jni::alias_ref<jstring> name, jint dataType, jni::alias_ref<jni::JArrayInt> shape) {
+  size_t dimensionsCount = shape->size();
+  std::unique_ptr<jint[]> dimensions = shape->getRegion(0, dimensionsCount);
+  std::vector<size_t> tensorShape;
+  tensorShape.reserve(dimensionsCount);
+  for (size_t i = 0; i < dimensionsCount; i++) {
+    if (dimensions[i] < 0) {
+      throw std::runtime_error("TypedResultSchema: Tensor dimensions cannot be negative!");
+    }
+    tensorShape.push_back(static_cast<size_t>(dimensions[i]));
+  }
+  _schema->addTensor(name->toStdString(), getDataType(dataType), tensorShape);
+}
+
+jni::local_ref<JTypedResultSchema::jhybriddata> JTypedResultSchema::initHybrid(jni::alias_ref<jhybridobject>, jint capacity) {
+  if (capacity < 0) {
+    throw std::runtime_error("TypedResultSchema: capacity cannot be negative!");
+  }
+  return makeCxxInstance(static_cast<size_t>(capacity));
+}
+
+} // namespace vision
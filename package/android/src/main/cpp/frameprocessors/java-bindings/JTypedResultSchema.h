@@ -0,0 +1,43 @@
+//
+// Created by Marc Rousavy on 15.10.26.
+//
+
+#pragma once
+
+#include "TypedResult.h"
+#include <fbjni/fbjni.h>
+#include <jni.h>
+#include <memory>
+
+namespace vision {
+
+using namespace facebook;
+
+class JTypedResultSchema : public jni::HybridClass<JTypedResultSchema> {
+public:
+  static auto constexpr kJavaDescriptor = "Lcom/mrousavy/camera/frameprocessors/TypedResultSchema;";
+  static void registerNatives();
+
+public:
+  const std::shared_ptr<TypedResultSchema>& getSchema() const;
+
+  /**
+   * Converts the `DATA_TYPE_*` constants of the Java part to a `TypedResultDataType`.
+   */
+  static TypedResultDataType getDataType(jint dataType);
+
+private:
+  jint getCapacity();
+  void addArray(jni::alias_ref<jstring> name, jint dataType, jint componentsCount);
+  void addTensor(jni::alias_ref<jstring> name, jint dataType, jni::alias_ref<jni::JArrayInt> shape);
+
+private:
+  friend HybridBase;
+  std::shared_ptr<TypedResultSchema> _schema;
+
+private:
+  explicit JTypedResultSchema(size_t capacity);
+  static jni::local_ref<jhybriddata> initHybrid(jni::alias_ref<jhybridobject> javaThis, jint capacity);
+};
+
+} // namespace vision
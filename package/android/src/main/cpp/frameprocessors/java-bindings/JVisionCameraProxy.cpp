@@ -29,6 +29,7 @@ JVisionCameraProxy::JVisionCameraProxy(const jni::alias_ref<JVisionCameraProxy::
                                        const jni::global_ref<JVisionCameraScheduler::javaobject>& scheduler) {
   _javaPart = make_global(javaThis);
   _runtime = runtime;
+  _nativeStates = std::make_shared<NativeStateRegistry>();
 
 #if VISION_CAMERA_ENABLE_FRAME_PROCESSORS
   __android_log_write(ANDROID_LOG_INFO, TAG, "Creating Worklet Context...");
@@ -39,7 +40,7 @@ JVisionCameraProxy::JVisionCameraProxy(const jni::alias_ref<JVisionCameraProxy::
   };
   auto runOnWorklet = [scheduler](std::function<void()>&& f) {
     // Run on Frame Processor Worklet Runtime
-    scheduler->cthis()->dispatchAsync([f = std::move(f)]() { f(); });
+    scheduler->cthis()->dispatchAsync(std::move(f));
   };
   _workletContext = std::make_shared<RNWorklet::JsiWorkletContext>("VisionCamera");
   _workletContext->initialize("VisionCamera", runtime, runOnJS, runOnWorklet);
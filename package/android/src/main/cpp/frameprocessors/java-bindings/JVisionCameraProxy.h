@@ -11,6 +11,7 @@
 #include "JFrameProcessor.h"
 #include "JFrameProcessorPlugin.h"
 #include "JVisionCameraScheduler.h"
+#include "NativeState.h"
 
 #include <memory>
 #include <string>
@@ -37,6 +38,17 @@ public:
     return _runtime;
   }
 
+  const std::shared_ptr<NativeStateRegistry>& getNativeStates() {
+    return _nativeStates;
+  }
+
+  /**
+   * Get the `NativeState` slot with the given name, or `nullptr` if no Frame Processor uses one.
+   */
+  std::shared_ptr<NativeState> getNativeState(const std::string& name) {
+    return _nativeStates->get(name);
+  }
+
 #if VISION_CAMERA_ENABLE_FRAME_PROCESSORS
   jsi::Runtime& getWorkletRuntime() {
     return _workletContext->getWorkletRuntime();
@@ -51,6 +63,7 @@ private:
   friend HybridBase;
   jni::global_ref<JVisionCameraProxy::javaobject> _javaPart;
   jsi::Runtime* _runtime;
+  std::shared_ptr<NativeStateRegistry> _nativeStates;
 #if VISION_CAMERA_ENABLE_FRAME_PROCESSORS
   std::shared_ptr<RNWorklet::JsiWorkletContext> _workletContext;
 #endif
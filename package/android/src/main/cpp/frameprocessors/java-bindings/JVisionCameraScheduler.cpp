@@ -4,6 +4,7 @@
 
 #include "JVisionCameraScheduler.h"
 #include <fbjni/fbjni.h>
+#include <utility>
 
 namespace vision {
 
@@ -14,11 +15,9 @@ TSelf JVisionCameraScheduler::initHybrid(jni::alias_ref<jhybridobject> jThis) {
   return makeCxxInstance(jThis);
 }
 
-void JVisionCameraScheduler::dispatchAsync(const std::function<void()>& job) {
-  std::unique_lock<std::mutex> lock(_mutex);
-  // 1. add job to queue
-  _jobs.push(job);
-  scheduleTrigger();
+void JVisionCameraScheduler::dispatchAsync(std::function<void()> job) {
+  // 1. add job to queue, only the first job of a batch schedules a trigger.
+  _jobs.dispatchAsync(std::move(job));
 }
 
 void JVisionCameraScheduler::scheduleTrigger() {
@@ -31,11 +30,8 @@ void JVisionCameraScheduler::scheduleTrigger() {
 }
 
 void JVisionCameraScheduler::trigger() {
-  std::unique_lock<std::mutex> lock(_mutex);
-  // 3. call job we enqueued in step 1.
-  auto job = _jobs.front();
-  job();
-  _jobs.pop();
+  // 3. call a batch of the jobs we enqueued in step 1.
+  _jobs.trigger();
 }
 
 void JVisionCameraScheduler::registerNatives() {
@@ -4,10 +4,10 @@
 
 #pragma once
 
+#include "BatchedJobQueue.h"
 #include <fbjni/fbjni.h>
+#include <functional>
 #include <jni.h>
-#include <mutex>
-#include <queue>
 
 namespace vision {
 
@@ -17,11 +17,13 @@ using namespace facebook;
  * A Scheduler that runs methods on the Frame Processor Thread (which is a Java Thread).
  * In order to call something on the Java Frame Processor Thread, you have to:
  *
- * 1. Call `dispatchAsync(..)` with the given C++ Method.
- * 2. Internally, `scheduleTrigger()` will get called, which is a Java Method.
+ * 1. Call `dispatchAsync(..)` with the given C++ Method, which pushes it onto a lock-free queue.
+ * 2. If no trigger is pending yet, `scheduleTrigger()` will get called, which is a Java Method.
  * 3. The `scheduleTrigger()` Java Method will switch to the Frame Processor Java Thread and call
  * `trigger()` on there
- * 4. `trigger()` is a C++ function here that just calls the passed C++ Method from step 1.
+ * 4. `trigger()` is a C++ function here that runs a batch of queued C++ Methods from step 1, without holding any lock.
+ *
+ * So a burst of jobs only costs a single Java round-trip.
  */
 class JVisionCameraScheduler : public jni::HybridClass<JVisionCameraScheduler> {
 public:
@@ -30,19 +32,19 @@ public:
   static void registerNatives();
 
   // schedules the given job to be run on the VisionCamera FP Thread at some future point in time
-  void dispatchAsync(const std::function<void()>& job);
+  void dispatchAsync(std::function<void()> job);
 
 private:
   friend HybridBase;
   jni::global_ref<JVisionCameraScheduler::javaobject> _javaPart;
-  std::queue<std::function<void()>> _jobs;
-  std::mutex _mutex;
+  BatchedJobQueue _jobs;
 
-  explicit JVisionCameraScheduler(jni::alias_ref<JVisionCameraScheduler::jhybridobject> jThis) : _javaPart(jni::make_global(jThis)) {}
+  explicit JVisionCameraScheduler(jni::alias_ref<JVisionCameraScheduler::jhybridobject> jThis)
+      : _javaPart(jni::make_global(jThis)), _jobs([this]() { scheduleTrigger(); }) {}
 
   // Schedules a call to `trigger` on the VisionCamera FP Thread
   void scheduleTrigger();
-  // Calls the latest job in the job queue
+  // Calls a batch of jobs from the job queue
   void trigger();
 };
 
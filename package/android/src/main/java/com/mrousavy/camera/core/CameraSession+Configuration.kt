@@ -1,6 +1,9 @@
 package com.mrousavy.camera.core
 
 import android.annotation.SuppressLint
+import android.content.Context
+import android.hardware.camera2.CameraCharacteristics
+import android.hardware.camera2.CameraManager
 import android.util.Log
 import androidx.annotation.OptIn
 import androidx.camera.core.CameraSelector
@@ -24,6 +27,19 @@ import com.mrousavy.camera.core.types.Torch
 import com.mrousavy.camera.core.types.VideoStabilizationMode
 import kotlin.math.roundToInt
 
+private fun CameraSession.getIsSensorTimestampRealtime(cameraId: String?): Boolean {
+  if (cameraId == null) return false
+  return try {
+    val cameraManager = context.getSystemService(Context.CAMERA_SERVICE) as CameraManager
+    val characteristics = cameraManager.getCameraCharacteristics(cameraId)
+    // REALTIME timestamps are in the BOOTTIME time base, UNKNOWN ones in the MONOTONIC time base.
+    characteristics.get(CameraCharacteristics.SENSOR_INFO_TIMESTAMP_SOURCE) == CameraCharacteristics.SENSOR_INFO_TIMESTAMP_SOURCE_REALTIME
+  } catch (e: Throwable) {
+    Log.w(CameraSession.TAG, "Failed to get the timestamp source of Camera #$cameraId, assuming MONOTONIC!", e)
+    false
+  }
+}
+
 private fun assertFormatRequirement(
   propName: String,
   format: CameraDeviceFormat?,
@@ -192,7 +208,10 @@ internal fun CameraSession.configureOutputs(configuration: CameraConfiguration)
         analysis.setResolutionSelector(resolutionSelector)
       }
     }.build()
-    val pipeline = FrameProcessorPipeline(callback)
+    // The Camera never delivers Frames slower than the lower bound of the FPS range, longer gaps are dropped Frames.
+    val minFps = fpsRange?.lower?.toDouble() ?: format?.minFps
+    val maxFrameDurationNs = if (minFps != null && minFps > 0) (1_000_000_000 / minFps).toLong() else 0L
+    val pipeline = FrameProcessorPipeline(callback, getIsSensorTimestampRealtime(configuration.cameraId), maxFrameDurationNs)
     analyzer.setAnalyzer(CameraQueues.videoQueue.executor, pipeline)
     frameProcessorOutput = analyzer
   } else {
@@ -6,10 +6,14 @@ import androidx.camera.core.ImageAnalysis.Analyzer
 import androidx.camera.core.ImageProxy
 import com.mrousavy.camera.frameprocessors.Frame
 
-class FrameProcessorPipeline(private val callback: CameraSession.Callback) : Analyzer {
+class FrameProcessorPipeline(
+  private val callback: CameraSession.Callback,
+  private val isTimestampRealtime: Boolean,
+  private val maxFrameDurationNs: Long
+) : Analyzer {
   @OptIn(ExperimentalGetImage::class)
   override fun analyze(imageProxy: ImageProxy) {
-    val frame = Frame(imageProxy)
+    val frame = Frame(imageProxy, isTimestampRealtime, maxFrameDurationNs)
     try {
       frame.incrementRefCount()
       callback.onFrame(frame)
@@ -15,13 +15,27 @@ import com.mrousavy.camera.core.HardwareBuffersNotAvailableError;
 import com.mrousavy.camera.core.types.PixelFormat;
 import com.mrousavy.camera.core.types.Orientation;
 import java.lang.IllegalStateException;
+import java.util.concurrent.atomic.AtomicInteger;
 
 public class Frame {
     private final ImageProxy imageProxy;
-    private int refCount = 0;
+    private final AtomicInteger refCount = new AtomicInteger(0);
+    private final boolean isTimestampRealtime;
+    private final long maxFrameDurationNs;
 
     public Frame(ImageProxy image) {
+        this(image, false, 0);
+    }
+
+    /**
+     * @param isTimestampRealtime Whether the timestamp is in the BOOTTIME time base
+     *                            (SENSOR_INFO_TIMESTAMP_SOURCE_REALTIME) instead of the MONOTONIC time base.
+     * @param maxFrameDurationNs The longest Frame interval the Camera is configured for (1 / min FPS), or 0 if unknown.
+     */
+    public Frame(ImageProxy image, boolean isTimestampRealtime, long maxFrameDurationNs) {
         this.imageProxy = image;
+        this.isTimestampRealtime = isTimestampRealtime;
+        this.maxFrameDurationNs = maxFrameDurationNs;
     }
 
     private void assertIsValid() throws FrameInvalidError {
@@ -69,7 +83,11 @@ public class Frame {
     @DoNotStrip
     public boolean getIsMirrored() throws FrameInvalidError {
         assertIsValid();
-        Matrix matrix = imageProxy.getImageInfo().getSensorToBufferTransformMatrix();
+        return getIsMirrored(imageProxy);
+    }
+
+    static boolean getIsMirrored(ImageProxy image) {
+        Matrix matrix = image.getImageInfo().getSensorToBufferTransformMatrix();
         float[] values = new float[9];
         matrix.getValues(values);
         // Check if the X scale factor is negative, indicating a horizontal flip.
@@ -87,7 +105,19 @@ public class Frame {
     @DoNotStrip
     public Orientation getOrientation() throws FrameInvalidError {
         assertIsValid();
-        int degrees = imageProxy.getImageInfo().getRotationDegrees();
+        return getOrientation(imageProxy);
+    }
+
+    public boolean getIsTimestampRealtime() {
+        return isTimestampRealtime;
+    }
+
+    public long getMaxFrameDurationNs() {
+        return maxFrameDurationNs;
+    }
+
+    static Orientation getOrientation(ImageProxy image) {
+        int degrees = image.getImageInfo().getRotationDegrees();
         Orientation orientation = Orientation.Companion.fromRotationDegrees(degrees);
         // .rotationDegrees is the rotation that needs to be applied to make the image appear
         // upright. Our orientation is the actual orientation of the Frame, so the opposite. Reverse it.
@@ -98,7 +128,11 @@ public class Frame {
     @DoNotStrip
     public PixelFormat getPixelFormat() throws FrameInvalidError {
         assertIsValid();
-        return PixelFormat.Companion.fromImageFormat(imageProxy.getFormat());
+        return getPixelFormat(imageProxy);
+    }
+
+    static PixelFormat getPixelFormat(ImageProxy image) {
+        return PixelFormat.Companion.fromImageFormat(image.getFormat());
     }
 
     @SuppressWarnings("unused")
@@ -129,8 +163,8 @@ public class Frame {
         return getImage().getHardwareBuffer();
     }
 
-    private synchronized boolean getIsImageValid(ImageProxy image) {
-        if (refCount <= 0) return false;
+    private boolean getIsImageValid(ImageProxy image) {
+        if (refCount.get() <= 0) return false;
         try {
             // will throw an exception if the image is already closed
             image.getFormat();
@@ -144,15 +178,14 @@ public class Frame {
 
     @SuppressWarnings("unused")
     @DoNotStrip
-    public synchronized void incrementRefCount() {
-        refCount++;
+    public void incrementRefCount() {
+        refCount.incrementAndGet();
     }
 
     @SuppressWarnings("unused")
     @DoNotStrip
-    public synchronized void decrementRefCount() {
-        refCount--;
-        if (refCount <= 0) {
+    public void decrementRefCount() {
+        if (refCount.decrementAndGet() <= 0) {
             // If no reference is held on this Image, close it.
             close();
         }
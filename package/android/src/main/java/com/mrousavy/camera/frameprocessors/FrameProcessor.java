@@ -1,9 +1,11 @@
 package com.mrousavy.camera.frameprocessors;
 
 import androidx.annotation.Keep;
+import androidx.camera.core.ImageProxy;
 
 import com.facebook.jni.HybridData;
 import com.facebook.proguard.annotations.DoNotStrip;
+import com.mrousavy.camera.core.FrameInvalidError;
 
 import dalvik.annotation.optimization.FastNative;
 
@@ -15,8 +17,37 @@ public final class FrameProcessor {
     /**
      * Call the JS Frame Processor function with the given Frame
      */
+    public void call(Frame frame) throws FrameInvalidError {
+        // Snapshot all metadata once and pass it to C++ in a single JNI call,
+        // so JS property reads (frame.width, frame.orientation, ...) don't call back into Java.
+        // Enum ordinals must match vision::FrameOrientation and vision::FramePixelFormat in FrameMetadata.h.
+        ImageProxy image = frame.getImageProxy();
+        ImageProxy.PlaneProxy[] planes = image.getPlanes();
+        call(frame,
+             image.getWidth(),
+             image.getHeight(),
+             planes[0].getRowStride(),
+             planes.length,
+             image.getImageInfo().getTimestamp(),
+             frame.getIsTimestampRealtime(),
+             frame.getMaxFrameDurationNs(),
+             Frame.getOrientation(image).ordinal(),
+             Frame.getPixelFormat(image).ordinal(),
+             Frame.getIsMirrored(image));
+    }
+
     @FastNative
-    public native void call(Frame frame);
+    private native void call(Frame frame,
+                             int width,
+                             int height,
+                             int bytesPerRow,
+                             int planesCount,
+                             long timestamp,
+                             boolean isTimestampRealtime,
+                             long maxFrameDurationNs,
+                             int orientation,
+                             int pixelFormat,
+                             boolean isMirrored);
 
     /** @noinspection FieldCanBeLocal, unused */
     @DoNotStrip
@@ -30,8 +30,14 @@ public abstract class FrameProcessorPlugin {
      * The actual Frame Processor Plugin's implementation that runs when `plugin.call(..)` is called in the JS Frame Processor.
      * Implement your Frame Processing here, and keep in mind that this is a hot-path so optimize as good as possible.
      * See: <a href="https://react-native-vision-camera.com/docs/guides/frame-processors-tips#fast-frame-processor-plugins">Performance Tips</a>
+     * <p>
+     * In a parallel group ({@code VisionCameraProxy.createParallelGroup(..)}), this is called on a native worker Thread,
+     * concurrently with the other Plugins of the group.
      *
      * @param frame The Frame from the Camera. Don't call .close() on this, as VisionCamera handles that.
+     * @param params The options passed from the JS side, or {@code null} if none. Unchanged options reuse the same Map
+     *               instance across calls, so don't modify it. In a pipeline ({@code VisionCameraProxy.createPipeline(..)}),
+     *               it also contains the result of the previous Plugin as {@code "previousResult"}.
      * @return You can return any primitive, map or array you want.
      *         See the <a href="https://react-native-vision-camera.com/docs/guides/frame-processors-plugins-overview#types">Types</a>
      *         table for a list of supported types.
@@ -0,0 +1,63 @@
+package com.mrousavy.camera.frameprocessors;
+
+import androidx.annotation.Keep;
+
+import com.facebook.jni.HybridData;
+import com.facebook.proguard.annotations.DoNotStrip;
+
+import java.nio.ByteBuffer;
+import java.nio.ByteOrder;
+import java.nio.FloatBuffer;
+import java.nio.IntBuffer;
+
+import dalvik.annotation.optimization.FastNative;
+
+/**
+ * A preallocated native buffer laid out by a {@link TypedResultSchema}.
+ * Write the values into the field buffers, set the number of valid rows with {@link #setCount(int)}, and return the result
+ * from {@link FrameProcessorPlugin#callback}. In JS it becomes {@code { count, [field]: Float32Array | Int32Array }}.
+ * <p>
+ * The contents of a new result are undefined. The field buffers are only valid as long as this result is referenced.
+ *
+ * @noinspection JavaJniMissingFunction
+ */
+public final class TypedResult {
+    /** @noinspection FieldCanBeLocal, unused */
+    @DoNotStrip
+    @Keep
+    private final HybridData mHybridData;
+
+    TypedResult(TypedResultSchema schema) {
+        mHybridData = initHybrid(schema);
+    }
+
+    /**
+     * Gets the buffer of the given {@code Float32} field, in native byte order.
+     */
+    public FloatBuffer getFloatBuffer(String field) {
+        return getFieldByteBuffer(field, TypedResultSchema.DATA_TYPE_FLOAT32).order(ByteOrder.nativeOrder()).asFloatBuffer();
+    }
+
+    /**
+     * Gets the buffer of the given {@code Int32} field, in native byte order.
+     */
+    public IntBuffer getIntBuffer(String field) {
+        return getFieldByteBuffer(field, TypedResultSchema.DATA_TYPE_INT32).order(ByteOrder.nativeOrder()).asIntBuffer();
+    }
+
+    /**
+     * Sets the number of valid rows of all Array fields. Must not exceed the capacity of the schema.
+     */
+    @FastNative
+    public native void setCount(int count);
+
+    /**
+     * Gets the number of valid rows of all Array fields.
+     */
+    @FastNative
+    public native int getCount();
+
+    @FastNative
+    private native ByteBuffer getFieldByteBuffer(String field, int dataType);
+    private native HybridData initHybrid(TypedResultSchema schema);
+}
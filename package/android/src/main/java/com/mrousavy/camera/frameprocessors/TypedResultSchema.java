@@ -0,0 +1,82 @@
+package com.mrousavy.camera.frameprocessors;
+
+import androidx.annotation.Keep;
+
+import com.facebook.jni.HybridData;
+import com.facebook.proguard.annotations.DoNotStrip;
+
+/**
+ * Describes the layout of the values a Frame Processor Plugin returns as a {@link TypedResult}.
+ * A schema is a struct-of-arrays: Array fields hold up to {@code capacity} rows of a fixed number of components,
+ * Tensor fields hold a fixed number of values. In JS, every field becomes a {@code Float32Array} or {@code Int32Array}
+ * of one shared {@code ArrayBuffer}, without boxing individual values.
+ * <p>
+ * Create the schema once (e.g. in the Plugin's constructor), fields cannot be added after a result has been created.
+ *
+ * @noinspection JavaJniMissingFunction
+ */
+public final class TypedResultSchema {
+    static final int DATA_TYPE_FLOAT32 = 0;
+    static final int DATA_TYPE_INT32 = 1;
+
+    /** @noinspection FieldCanBeLocal, unused */
+    @DoNotStrip
+    @Keep
+    private final HybridData mHybridData;
+
+    /**
+     * Create a new schema.
+     * @param capacity The maximum number of rows of Array fields, e.g. the maximum number of detected faces.
+     */
+    public TypedResultSchema(int capacity) {
+        mHybridData = initHybrid(capacity);
+    }
+
+    /**
+     * Adds a {@code Float32Array} field with {@code componentsCount} values per row.
+     */
+    public TypedResultSchema addFloat32Array(String name, int componentsCount) {
+        addArray(name, DATA_TYPE_FLOAT32, componentsCount);
+        return this;
+    }
+
+    /**
+     * Adds an {@code Int32Array} field with {@code componentsCount} values per row.
+     */
+    public TypedResultSchema addInt32Array(String name, int componentsCount) {
+        addArray(name, DATA_TYPE_INT32, componentsCount);
+        return this;
+    }
+
+    /**
+     * Adds a {@code Float32Array} field with a fixed shape, e.g. a segmentation mask.
+     */
+    public TypedResultSchema addFloat32Tensor(String name, int... shape) {
+        addTensor(name, DATA_TYPE_FLOAT32, shape);
+        return this;
+    }
+
+    /**
+     * Adds an {@code Int32Array} field with a fixed shape.
+     */
+    public TypedResultSchema addInt32Tensor(String name, int... shape) {
+        addTensor(name, DATA_TYPE_INT32, shape);
+        return this;
+    }
+
+    /**
+     * Creates a new result backed by a pooled native buffer. Create a new result for every call of the Plugin.
+     */
+    public TypedResult createResult() {
+        return new TypedResult(this);
+    }
+
+    /**
+     * Gets the maximum number of rows of Array fields.
+     */
+    public native int getCapacity();
+
+    private native void addArray(String name, int dataType, int componentsCount);
+    private native void addTensor(String name, int dataType, int[] shape);
+    private native HybridData initHybrid(int capacity);
+}
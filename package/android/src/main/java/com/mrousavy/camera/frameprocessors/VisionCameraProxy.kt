@@ -39,12 +39,15 @@ class VisionCameraProxy(private val reactContext: ReactApplicationContext) {
   }
 
   @UiThread
-  private fun findCameraViewById(viewId: Int): CameraView {
+  private fun findCameraViewById(viewId: Int): CameraView = findCameraViewByIdOrNull(viewId) ?: throw ViewNotFoundError(viewId)
+
+  @UiThread
+  private fun findCameraViewByIdOrNull(viewId: Int): CameraView? {
     Log.d(TAG, "Finding view $viewId...")
     val ctx = mContext.get()
     val view = if (ctx != null) UIManagerHelper.getUIManager(ctx, viewId)?.resolveView(viewId) as CameraView? else null
     Log.d(TAG, if (view != null) "Found view $viewId!" else "Couldn't find view $viewId!")
-    return view ?: throw ViewNotFoundError(viewId)
+    return view
   }
 
   @Suppress("unused")
@@ -62,7 +65,8 @@ class VisionCameraProxy(private val reactContext: ReactApplicationContext) {
   @Keep
   fun removeFrameProcessor(viewId: Int) {
     UiThreadUtil.runOnUiThread {
-      val view = findCameraViewById(viewId)
+      // The view is already gone if the Camera was unmounted
+      val view = findCameraViewByIdOrNull(viewId) ?: return@runOnUiThread
       view.frameProcessor = null
     }
   }
@@ -0,0 +1,25 @@
+# Platform-independent Frame Processor sources, shared by the Android library and the host build (cpp/CMakeLists.txt).
+set(
+        VISION_CAMERA_CORE_SOURCES
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/ArrayBufferPool.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameArena.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameHostObject.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FramePlane.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameProcessorTimings.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameProperty.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameResize.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameScope.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/FrameSequenceTracker.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/ImageRotation.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/LatencyHistogram.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/NativeState.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/NativeStateHostObject.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/ObjectShape.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/PixelConversion.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/PluginOptionsCache.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/SyntheticFrameSource.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/ThreadPool.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/TypedArray.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/TypedResult.cpp
+        ${CMAKE_CURRENT_LIST_DIR}/frameprocessors/VisionCameraStats.cpp
+)
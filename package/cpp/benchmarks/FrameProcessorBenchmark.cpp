@@ -0,0 +1,58 @@
+//
+//  FrameProcessorBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+#include "TestRuntime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+
+using namespace vision;
+
+// The overhead of a Frame Processor call itself: wrapping the Frame, the FrameScope and calling into JS.
+static void BM_FrameProcessor_Empty(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, "(frame) => {}");
+  auto frame = SyntheticFrame::createTestPattern(1920, 1080, FramePixelFormat::YUV, 0);
+
+  for (auto _ : state) {
+    frameProcessor.call(frame);
+  }
+}
+BENCHMARK(BM_FrameProcessor_Empty);
+
+// A typical Frame Processor that only reads metadata.
+static void BM_FrameProcessor_ReadMetadata(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    if (frame.isValid) {
+      globalThis.pixels = frame.width * frame.height + frame.bytesPerRow + frame.planesCount
+      globalThis.orientation = frame.orientation
+    }
+  })");
+  auto frame = SyntheticFrame::createTestPattern(1920, 1080, FramePixelFormat::YUV, 0);
+
+  for (auto _ : state) {
+    frameProcessor.call(frame);
+  }
+}
+BENCHMARK(BM_FrameProcessor_ReadMetadata);
+
+// A full 1080p YUV Frame copied into an ArrayBuffer per call.
+static void BM_FrameProcessor_ToArrayBuffer(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, "(frame) => { globalThis.size = frame.toArrayBuffer().byteLength }");
+  auto frame = SyntheticFrame::createTestPattern(1920, 1080, FramePixelFormat::YUV, 0);
+
+  for (auto _ : state) {
+    frameProcessor.call(frame);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameProcessor_ToArrayBuffer);
@@ -0,0 +1,72 @@
+//
+//  FramePropertyBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameProperty.h"
+#include "RuntimeCache.h"
+#include "TestRuntime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace vision;
+
+// The names looked up, by how far down the FrameProperty table they are
+static const char* const kLookups[] = {"incrementRefCount", "width", "withBaseClass", "notAFrameProperty"};
+
+// FrameHostObject::get(..) with interned names: one identity check per known property.
+static void BM_FramePropertyNames_Find(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  const auto& names = FramePropertyNames::forRuntime(*runtime);
+  jsi::PropNameID name = jsi::PropNameID::forAscii(*runtime, kLookups[state.range(0)]);
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(names.find(*runtime, name));
+  }
+  state.SetLabel(kLookups[state.range(0)]);
+}
+BENCHMARK(BM_FramePropertyNames_Find)->DenseRange(0, 3);
+
+// The baseline FramePropertyNames replaced: converting the name to UTF-8 and comparing strings.
+static void BM_FramePropertyNames_Utf8Compare(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  jsi::PropNameID name = jsi::PropNameID::forAscii(*runtime, kLookups[state.range(0)]);
+
+  for (auto _ : state) {
+    std::string utf8 = name.utf8(*runtime);
+    for (size_t i = 0; i < kFramePropertyCount; i++) {
+      if (utf8 == getFramePropertyName(static_cast<FrameProperty>(i))) {
+        benchmark::DoNotOptimize(i);
+        break;
+      }
+    }
+  }
+  state.SetLabel(kLookups[state.range(0)]);
+}
+BENCHMARK(BM_FramePropertyNames_Utf8Compare)->DenseRange(0, 3);
+
+// Every property access resolves the per-Runtime table first, so the Thread-local fast path has to be close to free.
+static void BM_RuntimeCache_Get(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&RuntimeCache<FramePropertyNames>::get(*runtime));
+  }
+}
+BENCHMARK(BM_RuntimeCache_Get);
+
+// Alternating between two Runtimes (e.g. the Frame Processor and a runAsync context) misses the fast path every time.
+static void BM_RuntimeCache_GetAlternating(benchmark::State& state) {
+  auto first = TestRuntime::create();
+  auto second = TestRuntime::create();
+  bool isFirst = true;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(&RuntimeCache<FramePropertyNames>::get(isFirst ? *first : *second));
+    isFirst = !isFirst;
+  }
+}
+BENCHMARK(BM_RuntimeCache_GetAlternating);
@@ -0,0 +1,117 @@
+//
+//  FrameResizeBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameResize.h"
+#include "PixelConversion.h"
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <vector>
+
+using namespace vision;
+
+namespace {
+
+// A 1080p NV12 Frame, like the Camera delivers it on iOS and most Android devices.
+struct NV12Frame {
+  static constexpr int32_t kWidth = 1920;
+  static constexpr int32_t kHeight = 1080;
+  std::vector<uint8_t> y = std::vector<uint8_t>(static_cast<size_t>(kWidth) * kHeight, 100);
+  std::vector<uint8_t> uv = std::vector<uint8_t>(static_cast<size_t>(kWidth) * kHeight / 2, 140);
+
+  std::vector<FramePlane> getPlanes() {
+    return {{y.data(), kWidth, kHeight, kWidth, 1}, {uv.data(), kWidth / 2, kHeight / 2, kWidth, 2}};
+  }
+};
+
+ResizeOptions createOptions(int32_t size, ResizeInterpolation interpolation, ResizeDataType dataType) {
+  ResizeOptions options;
+  options.width = size;
+  options.height = size;
+  options.cropX = 0;
+  options.cropY = 0;
+  options.cropWidth = NV12Frame::kWidth;
+  options.cropHeight = NV12Frame::kHeight;
+  options.layout = PixelLayout::RGB;
+  options.dataType = dataType;
+  options.interpolation = interpolation;
+  options.mean = {0.485f, 0.456f, 0.406f};
+  options.std = {0.229f, 0.224f, 0.225f};
+  options.orientation = {RotationAngle::Degrees0, false};
+  return options;
+}
+
+} // namespace
+
+// The typical ML preprocessing step: a full 1080p Frame to a small RGB model input.
+static void BM_FrameResize(benchmark::State& state) {
+  NV12Frame frame;
+  std::vector<FramePlane> planes = frame.getPlanes();
+  ResizeOptions options = createOptions(static_cast<int32_t>(state.range(0)), static_cast<ResizeInterpolation>(state.range(1)),
+                                        static_cast<ResizeDataType>(state.range(2)));
+
+  for (auto _ : state) {
+    auto buffer = resizeFramePlanes(planes, PixelLayout::BGRA, false, options);
+    benchmark::DoNotOptimize(buffer->data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameResize)
+    ->ArgNames({"size", "interpolation", "dataType"})
+    ->ArgsProduct({{224, 640},
+                   {static_cast<int>(ResizeInterpolation::Bilinear), static_cast<int>(ResizeInterpolation::Area)},
+                   {static_cast<int>(ResizeDataType::Uint8), static_cast<int>(ResizeDataType::Float32)}})
+    ->Unit(benchmark::kMicrosecond);
+
+// Resizing a portrait Frame into an up-right model input also rotates the (small) result.
+static void BM_FrameResize_Rotated(benchmark::State& state) {
+  NV12Frame frame;
+  std::vector<FramePlane> planes = frame.getPlanes();
+  ResizeOptions options = createOptions(224, ResizeInterpolation::Bilinear, ResizeDataType::Float32);
+  options.orientation = {RotationAngle::Degrees90, false};
+
+  for (auto _ : state) {
+    auto buffer = resizeFramePlanes(planes, PixelLayout::BGRA, false, options);
+    benchmark::DoNotOptimize(buffer->data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameResize_Rotated)->Unit(benchmark::kMicrosecond);
+
+// The same preprocessing as three separate full passes: convert the whole Frame to RGBA, resize it, then normalize.
+static void BM_FrameResize_SeparatePasses(benchmark::State& state) {
+  NV12Frame frame;
+  std::vector<FramePlane> planes = frame.getPlanes();
+  auto size = static_cast<int32_t>(state.range(0));
+  ResizeOptions options = createOptions(size, static_cast<ResizeInterpolation>(state.range(1)), ResizeDataType::Uint8);
+  constexpr size_t kRGBABytesPerRow = static_cast<size_t>(NV12Frame::kWidth) * 4;
+  std::vector<uint8_t> rgba(kRGBABytesPerRow * NV12Frame::kHeight);
+  std::vector<FramePlane> rgbaPlanes = {{rgba.data(), NV12Frame::kWidth, NV12Frame::kHeight, static_cast<int32_t>(kRGBABytesPerRow), 4}};
+  YUVImageView yuv = {NV12Frame::kWidth, NV12Frame::kHeight, frame.y.data(), NV12Frame::kWidth, frame.uv.data(), frame.uv.data() + 1,
+                      NV12Frame::kWidth, 2, false};
+  std::vector<float> normalized(static_cast<size_t>(size) * size * 3);
+  const std::array<float, 3> mean = {0.485f, 0.456f, 0.406f};
+  const std::array<float, 3> std = {0.229f, 0.224f, 0.225f};
+
+  for (auto _ : state) {
+    PixelConversion::convert(yuv, rgba.data(), kRGBABytesPerRow, PixelLayout::RGBA);
+    auto resized = resizeFramePlanes(rgbaPlanes, PixelLayout::RGBA, false, options);
+    const uint8_t* pixels = resized->data();
+    for (size_t i = 0; i < normalized.size(); i++) {
+      normalized[i] = (pixels[i] / 255.0f - mean[i % 3]) / std[i % 3];
+    }
+    benchmark::DoNotOptimize(normalized.data());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_FrameResize_SeparatePasses)
+    ->ArgNames({"size", "interpolation"})
+    ->ArgsProduct({{224, 640}, {static_cast<int>(ResizeInterpolation::Bilinear), static_cast<int>(ResizeInterpolation::Area)}})
+    ->Unit(benchmark::kMicrosecond);
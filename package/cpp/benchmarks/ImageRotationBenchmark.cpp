@@ -0,0 +1,115 @@
+//
+//  ImageRotationBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ImageRotation.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+using namespace vision;
+
+static constexpr int32_t kWidth = 1920;
+static constexpr int32_t kHeight = 1080;
+
+// Rotating a 1080p plane with 1 (Y), 2 (interleaved CbCr) or 4 (RGBA) byte pixels, e.g. for `toArrayBuffer({ orientation: 'upright' })`.
+static void BM_ImageRotation_Rotate(benchmark::State& state) {
+  size_t bytesPerPixel = static_cast<size_t>(state.range(0));
+  OrientationOptions options{static_cast<RotationAngle>(state.range(1)), state.range(2) != 0};
+  std::vector<uint8_t> source(kWidth * kHeight * bytesPerPixel, 100);
+  std::vector<uint8_t> destination(source.size());
+  int32_t destinationWidth = options.isTransposed() ? kHeight : kWidth;
+
+  for (auto _ : state) {
+    ImageRotation::rotate(source.data(), kWidth, kHeight, kWidth * bytesPerPixel, destination.data(), destinationWidth * bytesPerPixel,
+                          bytesPerPixel, options);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+BENCHMARK(BM_ImageRotation_Rotate)
+    ->ArgNames({"bytesPerPixel", "rotation", "mirror"})
+    ->ArgsProduct({{1, 2, 4},
+                   {static_cast<int>(RotationAngle::Degrees90), static_cast<int>(RotationAngle::Degrees180),
+                    static_cast<int>(RotationAngle::Degrees270)},
+                   {0}})
+    ->Args({1, static_cast<int>(RotationAngle::Degrees0), 1})
+    ->Args({4, static_cast<int>(RotationAngle::Degrees0), 1})
+    ->Args({4, static_cast<int>(RotationAngle::Degrees90), 1})
+    ->Unit(benchmark::kMicrosecond);
+
+// The textbook implementation: one thread, and the destination position of every pixel is computed on its own.
+static void rotateNaive(const uint8_t* source, int32_t width, int32_t height, size_t sourceBytesPerRow, uint8_t* destination,
+                        size_t destinationBytesPerRow, size_t bytesPerPixel, const OrientationOptions& options) {
+  int32_t destinationWidth = options.isTransposed() ? height : width;
+  for (int32_t y = 0; y < height; y++) {
+    for (int32_t x = 0; x < width; x++) {
+      int32_t destinationX, destinationY;
+      switch (options.rotation) {
+        case RotationAngle::Degrees0:
+          destinationX = x, destinationY = y;
+          break;
+        case RotationAngle::Degrees90:
+          destinationX = height - 1 - y, destinationY = x;
+          break;
+        case RotationAngle::Degrees180:
+          destinationX = width - 1 - x, destinationY = height - 1 - y;
+          break;
+        case RotationAngle::Degrees270:
+          destinationX = y, destinationY = width - 1 - x;
+          break;
+      }
+      if (options.mirror) {
+        destinationX = destinationWidth - 1 - destinationX;
+      }
+      std::memcpy(destination + destinationY * destinationBytesPerRow + destinationX * bytesPerPixel,
+                  source + y * sourceBytesPerRow + x * bytesPerPixel, bytesPerPixel);
+    }
+  }
+}
+
+// The same planes through the naive per-pixel loop, as a baseline for BM_ImageRotation_Rotate.
+static void BM_ImageRotation_NaiveBaseline(benchmark::State& state) {
+  size_t bytesPerPixel = static_cast<size_t>(state.range(0));
+  OrientationOptions options{static_cast<RotationAngle>(state.range(1)), state.range(2) != 0};
+  std::vector<uint8_t> source(kWidth * kHeight * bytesPerPixel, 100);
+  std::vector<uint8_t> destination(source.size());
+  int32_t destinationWidth = options.isTransposed() ? kHeight : kWidth;
+
+  for (auto _ : state) {
+    rotateNaive(source.data(), kWidth, kHeight, kWidth * bytesPerPixel, destination.data(), destinationWidth * bytesPerPixel, bytesPerPixel,
+                options);
+    benchmark::ClobberMemory();
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+BENCHMARK(BM_ImageRotation_NaiveBaseline)
+    ->ArgNames({"bytesPerPixel", "rotation", "mirror"})
+    ->ArgsProduct({{1, 2, 4},
+                   {static_cast<int>(RotationAngle::Degrees90), static_cast<int>(RotationAngle::Degrees180),
+                    static_cast<int>(RotationAngle::Degrees270)},
+                   {0}})
+    ->Args({1, static_cast<int>(RotationAngle::Degrees0), 1})
+    ->Args({4, static_cast<int>(RotationAngle::Degrees0), 1})
+    ->Args({4, static_cast<int>(RotationAngle::Degrees90), 1})
+    ->Unit(benchmark::kMicrosecond);
+
+// The same, into a new buffer from the ArrayBufferPool.
+static void BM_ImageRotation_RotateToPooledBuffer(benchmark::State& state) {
+  std::vector<uint8_t> source(kWidth * kHeight * 4, 100);
+  OrientationOptions options{RotationAngle::Degrees90, false};
+
+  for (auto _ : state) {
+    auto buffer = ImageRotation::rotateToPooledBuffer(source.data(), kWidth, kHeight, kWidth * 4, 4, options);
+    benchmark::DoNotOptimize(buffer->data());
+  }
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(source.size()));
+}
+BENCHMARK(BM_ImageRotation_RotateToPooledBuffer)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,35 @@
+//
+//  LatencyHistogramBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "LatencyHistogram.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+using namespace vision;
+
+// Every Frame Processor and Plugin call records into a histogram, so recording has to stay in the nanoseconds.
+static void BM_LatencyHistogram_Record(benchmark::State& state) {
+  // Shared by all benchmark Threads, like the Plugin histograms are
+  static LatencyHistogram histogram;
+  uint64_t value = 1;
+  for (auto _ : state) {
+    histogram.record(value);
+    value = (value * 7 + 13) % 100000;
+  }
+}
+BENCHMARK(BM_LatencyHistogram_Record)->Threads(1)->Threads(4);
+
+static void BM_LatencyHistogram_ScopedTimer(benchmark::State& state) {
+  LatencyHistogram histogram;
+  for (auto _ : state) {
+    ScopedLatencyTimer timer(histogram);
+  }
+}
+BENCHMARK(BM_LatencyHistogram_ScopedTimer);
@@ -0,0 +1,87 @@
+//
+//  ObjectShapeBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ObjectShape.h"
+#include "RuntimeCache.h"
+#include "TestRuntime.h"
+
+#include <benchmark/benchmark.h>
+
+#include <string>
+
+using namespace vision;
+
+// 100 bounding boxes, like a detector Plugin receives or returns them
+static constexpr const char* kBoxes = R"(Array.from({ length: 100 }, (_, i) => ({ x: i, y: i, width: 10, height: 20, label: 'face' })))";
+
+// Converting an array of similarly-shaped objects: one shape, every element only gets matched against it.
+static void BM_ObjectShape_Matches(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  jsi::Array boxes = TestRuntime::evaluate(*runtime, kBoxes).asObject(*runtime).asArray(*runtime);
+  size_t count = boxes.size(*runtime);
+
+  for (auto _ : state) {
+    ObjectShape shape(*runtime, boxes.getValueAtIndex(*runtime, 0).asObject(*runtime));
+    for (size_t i = 0; i < count; i++) {
+      jsi::Object box = boxes.getValueAtIndex(*runtime, i).asObject(*runtime);
+      if (!shape.matches(*runtime, box)) {
+        state.SkipWithError("Boxes should all have the same shape!");
+        return;
+      }
+      for (size_t p = 0; p < shape.size(); p++) {
+        benchmark::DoNotOptimize(box.getProperty(*runtime, shape.getPropName(p)));
+      }
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_ObjectShape_Matches);
+
+// The baseline: reading and UTF-8 encoding the property names of every element.
+static void BM_ObjectShape_EncodeEveryKey(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  jsi::Array boxes = TestRuntime::evaluate(*runtime, kBoxes).asObject(*runtime).asArray(*runtime);
+  size_t count = boxes.size(*runtime);
+
+  for (auto _ : state) {
+    for (size_t i = 0; i < count; i++) {
+      jsi::Object box = boxes.getValueAtIndex(*runtime, i).asObject(*runtime);
+      jsi::Array names = box.getPropertyNames(*runtime);
+      size_t size = names.size(*runtime);
+      for (size_t p = 0; p < size; p++) {
+        std::string name = names.getValueAtIndex(*runtime, p).asString(*runtime).utf8(*runtime);
+        benchmark::DoNotOptimize(box.getProperty(*runtime, name.c_str()));
+      }
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * count));
+}
+BENCHMARK(BM_ObjectShape_EncodeEveryKey);
+
+// Looking up the native key of a property name that appears in every call. The UTF-16 conversion stands in for
+// creating a `jstring` or an `NSString*`.
+static void BM_PropertyKeyCache_Get(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  auto& cache = RuntimeCache<PropertyKeyCache<std::u16string>>::get(*runtime);
+  const std::string name = "boundingBox";
+  auto encode = [](const std::string& key) { return std::u16string(key.begin(), key.end()); };
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache.get(name, encode).data());
+  }
+}
+BENCHMARK(BM_PropertyKeyCache_Get);
+
+static void BM_PropertyKeyCache_EncodeBaseline(benchmark::State& state) {
+  const std::string name = "boundingBox";
+  for (auto _ : state) {
+    std::u16string key(name.begin(), name.end());
+    benchmark::DoNotOptimize(key.data());
+  }
+}
+BENCHMARK(BM_PropertyKeyCache_EncodeBaseline);
@@ -0,0 +1,70 @@
+//
+//  PixelConversionBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "PixelConversion.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <vector>
+
+using namespace vision;
+
+static constexpr int32_t kWidth = 1920;
+static constexpr int32_t kHeight = 1080;
+
+static void setPixelRate(benchmark::State& state) {
+  double megapixels = static_cast<double>(state.iterations()) * kWidth * kHeight / 1e6;
+  state.counters["MPix/s"] = benchmark::Counter(megapixels, benchmark::Counter::kIsRate);
+  state.SetLabel(PixelConversion::getKernelName());
+}
+
+// A 1080p NV12 (`uvPixelStride` = 2, iOS and most Android devices) or I420 (`uvPixelStride` = 1) Frame to the given layout.
+static void BM_PixelConversion_YUV(benchmark::State& state) {
+  auto layout = static_cast<PixelLayout>(state.range(0));
+  int32_t uvPixelStride = static_cast<int32_t>(state.range(1));
+  std::vector<uint8_t> y(static_cast<size_t>(kWidth) * kHeight, 100);
+  std::vector<uint8_t> uv(static_cast<size_t>(kWidth) * kHeight / 2, 140);
+  const uint8_t* v = uvPixelStride == 2 ? uv.data() + 1 : uv.data() + kWidth / 2;
+  YUVImageView view{kWidth, kHeight, y.data(), kWidth, uv.data(), v, kWidth, uvPixelStride, false};
+  size_t bytesPerRow = kWidth * getBytesPerPixel(layout);
+  std::vector<uint8_t> destination(bytesPerRow * kHeight);
+
+  for (auto _ : state) {
+    PixelConversion::convert(view, destination.data(), bytesPerRow, layout);
+    benchmark::ClobberMemory();
+  }
+  setPixelRate(state);
+}
+BENCHMARK(BM_PixelConversion_YUV)
+    ->ArgNames({"layout", "uvPixelStride"})
+    ->ArgsProduct({{static_cast<int>(PixelLayout::RGB), static_cast<int>(PixelLayout::RGBA), static_cast<int>(PixelLayout::BGRA),
+                    static_cast<int>(PixelLayout::Gray)},
+                   {1, 2}})
+    ->Unit(benchmark::kMillisecond);
+
+// A 1080p BGRA Frame (iOS `rgb` pixel format) to the given layout.
+static void BM_PixelConversion_Packed(benchmark::State& state) {
+  auto layout = static_cast<PixelLayout>(state.range(0));
+  std::vector<uint8_t> pixels(static_cast<size_t>(kWidth) * kHeight * 4, 120);
+  PackedImageView view{kWidth, kHeight, pixels.data(), kWidth * 4, PixelLayout::BGRA};
+  size_t bytesPerRow = kWidth * getBytesPerPixel(layout);
+  std::vector<uint8_t> destination(bytesPerRow * kHeight);
+
+  for (auto _ : state) {
+    PixelConversion::convert(view, destination.data(), bytesPerRow, layout);
+    benchmark::ClobberMemory();
+  }
+  setPixelRate(state);
+}
+BENCHMARK(BM_PixelConversion_Packed)
+    ->ArgName("layout")
+    ->Arg(static_cast<int>(PixelLayout::RGB))
+    ->Arg(static_cast<int>(PixelLayout::RGBA))
+    ->Arg(static_cast<int>(PixelLayout::Gray))
+    ->Unit(benchmark::kMillisecond);
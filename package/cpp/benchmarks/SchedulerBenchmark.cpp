@@ -0,0 +1,196 @@
+//
+//  SchedulerBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "LatencyHistogram.h"
+#include "MPSCQueue.h"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <queue>
+#include <thread>
+#include <utility>
+
+using namespace vision;
+
+namespace {
+
+using Job = std::function<void()>;
+
+// The queue JVisionCameraScheduler used before the MPSCQueue: a std::queue behind a mutex.
+class MutexQueue {
+public:
+  void push(Job&& job) {
+    std::unique_lock lock(_mutex);
+    _jobs.push(std::move(job));
+  }
+
+  std::optional<Job> pop() {
+    std::unique_lock lock(_mutex);
+    if (_jobs.empty()) {
+      return std::nullopt;
+    }
+    Job job = std::move(_jobs.front());
+    _jobs.pop();
+    return job;
+  }
+
+private:
+  std::mutex _mutex;
+  std::queue<Job> _jobs;
+};
+
+/**
+ * Models JVisionCameraScheduler without JNI: the consumer Thread stands in for the Frame Processor Thread's Looper,
+ * and `scheduleTrigger()` for the hop through Java.
+ *
+ * With `isBatching`, a trigger is only scheduled if none is pending and runs up to 64 jobs (the current scheduler).
+ * Without it, every job schedules its own trigger (the scheduler before).
+ */
+template <typename Queue> class Scheduler {
+public:
+  explicit Scheduler(bool isBatching) : _isBatching(isBatching), _thread([this]() { loop(); }) {}
+  ~Scheduler() {
+    {
+      std::unique_lock lock(_mutex);
+      _isStopped = true;
+    }
+    _condition.notify_one();
+    _thread.join();
+  }
+
+  void dispatchAsync(Job&& job) {
+    _jobs.push(std::move(job));
+    if (!_isBatching || !_isTriggerScheduled.exchange(true, std::memory_order_acq_rel)) {
+      scheduleTrigger();
+    }
+  }
+
+private:
+  static constexpr size_t kMaxJobsPerTrigger = 64;
+
+  void scheduleTrigger() {
+    {
+      std::unique_lock lock(_mutex);
+      _pendingTriggers++;
+    }
+    _condition.notify_one();
+  }
+
+  void trigger() {
+    // A read-modify-write, so that a concurrent dispatchAsync(..) either sees `false` or its job is visible below.
+    _isTriggerScheduled.exchange(false, std::memory_order_acq_rel);
+    size_t maxJobs = _isBatching ? kMaxJobsPerTrigger : 1;
+    for (size_t i = 0; i < maxJobs; i++) {
+      auto job = _jobs.pop();
+      if (!job.has_value()) {
+        return;
+      }
+      (*job)();
+    }
+    if (_isBatching && !_isTriggerScheduled.exchange(true, std::memory_order_acq_rel)) {
+      scheduleTrigger();
+    }
+  }
+
+  void loop() {
+    while (true) {
+      {
+        std::unique_lock lock(_mutex);
+        _condition.wait(lock, [this]() { return _isStopped || _pendingTriggers > 0; });
+        if (_isStopped) {
+          return;
+        }
+        _pendingTriggers--;
+      }
+      trigger();
+    }
+  }
+
+private:
+  bool _isBatching;
+  Queue _jobs;
+  std::atomic<bool> _isTriggerScheduled{false};
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  size_t _pendingTriggers = 0;
+  bool _isStopped = false;
+  std::thread _thread;
+};
+
+// Jobs dispatched per iteration, e.g. a burst of runAsync calls and their completions
+constexpr int64_t kJobsPerIteration = 256;
+
+template <typename Queue> void runSchedulerBenchmark(benchmark::State& state, bool isBatching) {
+  Scheduler<Queue> scheduler(isBatching);
+  LatencyHistogram latency;
+  std::atomic<int64_t> doneJobs{0};
+  int64_t dispatchedJobs = 0;
+
+  for (auto _ : state) {
+    for (int64_t i = 0; i < kJobsPerIteration; i++) {
+      auto enqueuedAt = std::chrono::steady_clock::now();
+      scheduler.dispatchAsync([&latency, &doneJobs, enqueuedAt]() {
+        auto delay = std::chrono::steady_clock::now() - enqueuedAt;
+        latency.record(std::chrono::duration_cast<std::chrono::microseconds>(delay).count());
+        doneJobs.fetch_add(1, std::memory_order_release);
+      });
+    }
+    dispatchedJobs += kJobsPerIteration;
+    while (doneJobs.load(std::memory_order_acquire) < dispatchedJobs) {
+      std::this_thread::yield();
+    }
+  }
+
+  // Enqueue-to-run latency in microseconds, the snapshot is in milliseconds
+  LatencyHistogram::Snapshot snapshot = latency.getSnapshot();
+  state.counters["p50_us"] = snapshot.p50 * 1000;
+  state.counters["p99_us"] = snapshot.p99 * 1000;
+  state.SetItemsProcessed(state.iterations() * kJobsPerIteration);
+}
+
+} // namespace
+
+// Jobs per second and enqueue-to-run latency of the current scheduler.
+static void BM_Scheduler_MPSCQueueBatched(benchmark::State& state) {
+  runSchedulerBenchmark<MPSCQueue<Job>>(state, true);
+}
+BENCHMARK(BM_Scheduler_MPSCQueueBatched)->UseRealTime();
+
+// The scheduler before: a mutex-guarded queue and one trigger per job.
+static void BM_Scheduler_MutexQueueBaseline(benchmark::State& state) {
+  runSchedulerBenchmark<MutexQueue>(state, false);
+}
+BENCHMARK(BM_Scheduler_MutexQueueBaseline)->UseRealTime();
+
+// The raw queue without any Thread hand-off.
+static void BM_MPSCQueue_PushPop(benchmark::State& state) {
+  MPSCQueue<Job> queue;
+  for (auto _ : state) {
+    queue.push([]() {});
+    benchmark::DoNotOptimize(queue.pop());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MPSCQueue_PushPop);
+
+static void BM_MutexQueue_PushPop(benchmark::State& state) {
+  MutexQueue queue;
+  for (auto _ : state) {
+    queue.push([]() {});
+    benchmark::DoNotOptimize(queue.pop());
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_MutexQueue_PushPop);
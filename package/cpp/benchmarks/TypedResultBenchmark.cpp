@@ -0,0 +1,68 @@
+//
+//  TypedResultBenchmark.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "TestRuntime.h"
+#include "TypedResult.h"
+
+#include <benchmark/benchmark.h>
+
+#include <memory>
+#include <utility>
+
+using namespace vision;
+
+// A face mesh: 468 landmarks with x, y and z, plus a score per landmark.
+static constexpr size_t kLandmarksCount = 468;
+
+// A Plugin returning its landmarks as a TypedResult: one ArrayBuffer and a TypedArray view per field.
+static void BM_TypedResult_ToJSIValue(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  auto schema = std::make_shared<TypedResultSchema>(kLandmarksCount);
+  schema->addArray("landmarks", TypedResultDataType::Float32, 3);
+  schema->addArray("scores", TypedResultDataType::Float32, 1);
+
+  for (auto _ : state) {
+    TypedResult result(schema);
+    auto* landmarks = reinterpret_cast<float*>(result.getFieldData(0));
+    auto* scores = reinterpret_cast<float*>(result.getFieldData(1));
+    for (size_t i = 0; i < kLandmarksCount; i++) {
+      landmarks[i * 3 + 0] = static_cast<float>(i);
+      landmarks[i * 3 + 1] = static_cast<float>(i) * 0.5f;
+      landmarks[i * 3 + 2] = 0.0f;
+      scores[i] = 0.9f;
+    }
+    result.setCount(kLandmarksCount);
+    benchmark::DoNotOptimize(result.toJSIValue(*runtime));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kLandmarksCount);
+}
+BENCHMARK(BM_TypedResult_ToJSIValue);
+
+// The same values boxed into an Array of `{ x, y, z, score }` objects, which is what untyped Plugin results become.
+static void BM_TypedResult_BoxedBaseline(benchmark::State& state) {
+  auto runtime = TestRuntime::create();
+  jsi::PropNameID x = jsi::PropNameID::forAscii(*runtime, "x");
+  jsi::PropNameID y = jsi::PropNameID::forAscii(*runtime, "y");
+  jsi::PropNameID z = jsi::PropNameID::forAscii(*runtime, "z");
+  jsi::PropNameID score = jsi::PropNameID::forAscii(*runtime, "score");
+
+  for (auto _ : state) {
+    jsi::Array array(*runtime, kLandmarksCount);
+    for (size_t i = 0; i < kLandmarksCount; i++) {
+      jsi::Object landmark(*runtime);
+      landmark.setProperty(*runtime, x, static_cast<double>(i));
+      landmark.setProperty(*runtime, y, static_cast<double>(i) * 0.5);
+      landmark.setProperty(*runtime, z, 0.0);
+      landmark.setProperty(*runtime, score, 0.9);
+      array.setValueAtIndex(*runtime, i, std::move(landmark));
+    }
+    benchmark::DoNotOptimize(array);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * kLandmarksCount);
+}
+BENCHMARK(BM_TypedResult_BoxedBaseline);
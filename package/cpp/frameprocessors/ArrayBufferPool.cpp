@@ -0,0 +1,110 @@
+//
+//  ArrayBufferPool.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ArrayBufferPool.h"
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace vision {
+
+const std::shared_ptr<ArrayBufferPool>& ArrayBufferPool::getSharedInstance() {
+  static const std::shared_ptr<ArrayBufferPool> instance(new ArrayBufferPool());
+  return instance;
+}
+
+size_t ArrayBufferPool::getBucketCapacity(size_t size) {
+  return (size + kBucketAlignment - 1) / kBucketAlignment * kBucketAlignment;
+}
+
+std::shared_ptr<MutableRawBuffer> ArrayBufferPool::acquire(size_t size) {
+  size_t capacity = getBucketCapacity(size);
+  uint8_t* data = nullptr;
+
+  {
+    std::unique_lock lock(_mutex);
+    auto bucket = _freeBuffers.find(capacity);
+    if (bucket != _freeBuffers.end()) {
+      // Reuse the most recently released buffer, it is the most likely one to still be in the CPU caches
+      FreeList::iterator entry = bucket->second.back();
+      data = entry->data;
+      _freeList.erase(entry);
+      _freeBytes -= capacity;
+      bucket->second.pop_back();
+      if (bucket->second.empty()) {
+        _freeBuffers.erase(bucket);
+      }
+      _stats.hits++;
+    } else {
+      _stats.misses++;
+      _stats.bytesResident += capacity;
+    }
+    _stats.bytesInUse += capacity;
+  }
+
+  if (data == nullptr) {
+    data = new uint8_t[capacity];
+  }
+
+  // The MutableRawBuffer does not own the memory, instead it goes back into the pool once JS releases the ArrayBuffer.
+  std::weak_ptr<ArrayBufferPool> weakThis = weak_from_this();
+  return std::shared_ptr<MutableRawBuffer>(new MutableRawBuffer(data, size, false), [weakThis, data, capacity](MutableRawBuffer* buffer) {
+    delete buffer;
+    auto pool = weakThis.lock();
+    if (pool != nullptr) {
+      pool->recycle(data, capacity);
+    } else {
+      delete[] data;
+    }
+  });
+}
+
+void ArrayBufferPool::recycle(uint8_t* data, size_t capacity) {
+  std::vector<uint8_t*> evicted;
+  {
+    std::unique_lock lock(_mutex);
+    _stats.bytesInUse -= capacity;
+    auto& bucket = _freeBuffers[capacity];
+    if (bucket.size() >= kMaxFreeBuffersPerBucket) {
+      // Bucket is full
+      evicted.push_back(data);
+      _stats.bytesResident -= capacity;
+    } else {
+      bucket.push_back(_freeList.insert(_freeList.end(), FreeBuffer{data, capacity}));
+      _freeBytes += capacity;
+    }
+
+    // Free the least recently released buffers until all buckets together are below the cap again. A bucket's
+    // least recently released buffer is always its first one.
+    while (_freeBytes > kMaxFreeBytes) {
+      FreeBuffer oldest = _freeList.front();
+      auto oldestBucket = _freeBuffers.find(oldest.capacity);
+      oldestBucket->second.erase(oldestBucket->second.begin());
+      if (oldestBucket->second.empty()) {
+        _freeBuffers.erase(oldestBucket);
+      }
+      _freeList.pop_front();
+      _freeBytes -= oldest.capacity;
+      _stats.bytesResident -= oldest.capacity;
+      evicted.push_back(oldest.data);
+    }
+  }
+
+  // Free the memory outside of the lock.
+  for (uint8_t* buffer : evicted) {
+    delete[] buffer;
+  }
+}
+
+ArrayBufferPool::Stats ArrayBufferPool::getStats() const {
+  std::unique_lock lock(_mutex);
+  return _stats;
+}
+
+} // namespace vision
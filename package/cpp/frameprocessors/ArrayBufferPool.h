@@ -0,0 +1,89 @@
+//
+//  ArrayBufferPool.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "MutableRawBuffer.h"
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A size-bucketed pool of `MutableRawBuffer`s used for `ArrayBuffer`s handed out to JS (e.g. `Frame.toArrayBuffer()`).
+ *
+ * Every `acquire(..)` returns a distinct buffer, so a buffer that is still referenced from JS (e.g. in `runAsync`)
+ * is never overwritten by a later Frame. Once JS garbage-collects the `ArrayBuffer`, its memory goes back into the
+ * pool and is reused for the next buffer of the same bucket, so steady state is allocation-free.
+ *
+ * The free buffers of all buckets are capped at `kMaxFreeBytes` together. Once the cap is exceeded, the least recently
+ * released buffers are freed first, so buckets of a resolution that is no longer used don't pin memory forever.
+ */
+class ArrayBufferPool : public std::enable_shared_from_this<ArrayBufferPool> {
+public:
+  struct Stats {
+    // Number of `acquire(..)` calls that could reuse a pooled buffer
+    uint64_t hits = 0;
+    // Number of `acquire(..)` calls that had to allocate a new buffer
+    uint64_t misses = 0;
+    // Total bytes currently allocated by the pool, both in use and free
+    size_t bytesResident = 0;
+    // Bytes currently referenced from JS
+    size_t bytesInUse = 0;
+  };
+
+public:
+  // The largest buffer expected in steady state, a 4K RGBA Frame with rows padded to 4096 pixels.
+  static constexpr size_t kMaxFrameBytes = 4096 * 2160 * 4;
+  // Free buffers kept in all buckets together, in bytes. Anything above that is freed, least recently released first.
+  // Two of the largest Frames fit, so alternating 4K buffers (e.g. one still in `runAsync`) stay allocation-free.
+  static constexpr size_t kMaxFreeBytes = 2 * kMaxFrameBytes;
+
+public:
+  static const std::shared_ptr<ArrayBufferPool>& getSharedInstance();
+
+  /**
+   * Get a buffer of exactly `size` bytes. The contents of the buffer are undefined.
+   */
+  std::shared_ptr<MutableRawBuffer> acquire(size_t size);
+
+  Stats getStats() const;
+
+private:
+  ArrayBufferPool() = default;
+
+  struct FreeBuffer {
+    uint8_t* data;
+    size_t capacity;
+  };
+  using FreeList = std::list<FreeBuffer>;
+
+  void recycle(uint8_t* data, size_t capacity);
+  static size_t getBucketCapacity(size_t size);
+
+private:
+  mutable std::mutex _mutex;
+  // Free buffers of all buckets, least recently released first
+  FreeList _freeList;
+  // Free buffers keyed by their capacity, least recently released first
+  std::unordered_map<size_t, std::vector<FreeList::iterator>> _freeBuffers;
+  size_t _freeBytes = 0;
+  Stats _stats;
+
+  // Page-aligned buckets, so small stride differences (e.g. between Frames of the same format) share buffers
+  static constexpr size_t kBucketAlignment = 4096;
+  // Free buffers kept per bucket. Anything above that is freed once it gets released.
+  static constexpr size_t kMaxFreeBuffersPerBucket = 3;
+};
+
+} // namespace vision
@@ -0,0 +1,81 @@
+//
+//  BatchedJobQueue.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "MPSCQueue.h"
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <utility>
+
+namespace vision {
+
+/**
+ * The job queue of a Scheduler that runs jobs in batches on a single consumer Thread.
+ *
+ * Any Thread can `dispatchAsync(..)` a job. Only the first job after a batch started calls `scheduleTrigger`, which
+ * has to make the consumer Thread call `trigger()` at some point in the future. `trigger()` then runs up to
+ * `kMaxJobsPerTrigger` jobs, so jobs which dispatch new jobs cannot starve the consumer Thread.
+ */
+class BatchedJobQueue {
+public:
+  using Job = std::function<void()>;
+  static constexpr size_t kMaxJobsPerTrigger = 64;
+
+  explicit BatchedJobQueue(std::function<void()>&& scheduleTrigger)
+      : _scheduleTrigger(std::move(scheduleTrigger)), _isTriggerScheduled(false) {}
+
+  BatchedJobQueue(const BatchedJobQueue&) = delete;
+  BatchedJobQueue& operator=(const BatchedJobQueue&) = delete;
+
+public:
+  /**
+   * Enqueues the given job and schedules a trigger unless one is already pending. Safe to call from any Thread.
+   */
+  void dispatchAsync(Job&& job) {
+    _jobs.push(std::move(job));
+    scheduleTriggerIfNeeded();
+  }
+
+  /**
+   * Runs a batch of queued jobs. Must only be called on the consumer Thread, after `scheduleTrigger` was called.
+   */
+  void trigger() {
+    // Clearing the flag is a read-modify-write on the same atomic as the exchange in `scheduleTriggerIfNeeded()`.
+    // Either that exchange comes first, then this one acquires the job it published, or it comes later and sees
+    // `false`, then it schedules a new trigger. A plain store would allow the drain below to miss a job while the
+    // producer still sees `true`, and that job would be stranded until the next dispatch.
+    _isTriggerScheduled.exchange(false, std::memory_order_acq_rel);
+
+    for (size_t i = 0; i < kMaxJobsPerTrigger; i++) {
+      auto job = _jobs.pop();
+      if (!job.has_value()) {
+        return;
+      }
+      (*job)();
+    }
+    // There might be more jobs, yield the Thread and continue in a new trigger.
+    scheduleTriggerIfNeeded();
+  }
+
+private:
+  void scheduleTriggerIfNeeded() {
+    if (!_isTriggerScheduled.exchange(true, std::memory_order_acq_rel)) {
+      _scheduleTrigger();
+    }
+  }
+
+private:
+  std::function<void()> _scheduleTrigger;
+  MPSCQueue<Job> _jobs;
+  // Whether a call to `trigger` is already scheduled on the consumer Thread
+  std::atomic<bool> _isTriggerScheduled;
+};
+
+} // namespace vision
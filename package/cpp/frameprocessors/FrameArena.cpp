@@ -0,0 +1,70 @@
+//
+//  FrameArena.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameArena.h"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace vision {
+
+static thread_local FrameArena* currentArena = nullptr;
+
+FrameArena* FrameArena::getCurrent() noexcept {
+  return currentArena;
+}
+
+void FrameArena::setCurrent(FrameArena* arena) noexcept {
+  currentArena = arena;
+}
+
+void* FrameArena::allocate(size_t size, size_t alignment) {
+  if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+    throw std::invalid_argument("FrameArena: Alignment " + std::to_string(alignment) + " is not a power of two!");
+  }
+
+  if (!_chunks.empty()) {
+    Chunk& chunk = _chunks.back();
+    uintptr_t start = reinterpret_cast<uintptr_t>(chunk.data.get());
+    uintptr_t aligned = (start + _offset + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1);
+    size_t padding = aligned - (start + _offset);
+    if (_offset + padding + size <= chunk.size) {
+      _offset += padding + size;
+      _bytesUsed += padding + size;
+      return reinterpret_cast<void*>(aligned);
+    }
+  }
+
+  // The current chunk is full, start a new one that is big enough for this allocation.
+  size_t chunkSize = std::max(kMinChunkSize, size + alignment);
+  Chunk chunk;
+  // Not zero-filled like `std::make_unique<uint8_t[]>`, allocations from the arena are uninitialized anyway.
+  chunk.data = std::unique_ptr<uint8_t[]>(new uint8_t[chunkSize]);
+  chunk.size = chunkSize;
+  _chunks.push_back(std::move(chunk));
+  _bytesReserved += chunkSize;
+  _offset = 0;
+  return allocate(size, alignment);
+}
+
+void FrameArena::reset() {
+  if (_chunks.size() > 1) {
+    // Merge all chunks into one, so the next Frame does not need to allocate a new chunk again.
+    _chunks.clear();
+    Chunk chunk;
+    chunk.data = std::unique_ptr<uint8_t[]>(new uint8_t[_bytesReserved]);
+    chunk.size = _bytesReserved;
+    _chunks.push_back(std::move(chunk));
+  }
+  _offset = 0;
+  _bytesUsed = 0;
+}
+
+} // namespace vision
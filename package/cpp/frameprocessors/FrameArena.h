@@ -0,0 +1,88 @@
+//
+//  FrameArena.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A scratch allocator for temporary buffers that are only needed while a single Frame is being processed.
+ *
+ * Allocating is a pointer bump, and all allocations are freed at once when the Frame Processor returns, so
+ * plugins and host functions don't have to go through `malloc` (or the JS heap) for per-Frame scratch memory.
+ * After a Frame that needed more than one chunk, the chunks are merged so the next Frame fits into a single one.
+ *
+ * The arena is not thread-safe. Get it through `FrameArena::getCurrent()` on the Frame Processor Thread.
+ */
+class FrameArena {
+public:
+  FrameArena() = default;
+
+  FrameArena(const FrameArena&) = delete;
+  FrameArena& operator=(const FrameArena&) = delete;
+
+  /**
+   * Get the arena of the Frame that is currently being processed on this Thread, or `nullptr` if this Thread
+   * is not running a Frame Processor right now (e.g. in `runAsync(..)`, or on a parallel group's worker Thread).
+   * Memory from this arena must not be used after the Frame Processor returned.
+   */
+  static FrameArena* getCurrent() noexcept;
+
+public:
+  /**
+   * Allocates `size` bytes aligned to `alignment` (a power of two). The memory is uninitialized.
+   */
+  void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+  template <typename T> T* allocateArray(size_t count) {
+    return static_cast<T*>(allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  /**
+   * Frees all allocations at once, but keeps the memory around for the next Frame.
+   */
+  void reset();
+
+  /**
+   * The number of bytes allocated since the last `reset()`, including alignment padding.
+   */
+  inline size_t getBytesUsed() const noexcept {
+    return _bytesUsed;
+  }
+  /**
+   * The number of bytes this arena holds on to.
+   */
+  inline size_t getBytesReserved() const noexcept {
+    return _bytesReserved;
+  }
+
+private:
+  friend class FrameScope;
+  static void setCurrent(FrameArena* arena) noexcept;
+
+private:
+  static constexpr size_t kMinChunkSize = 64 * 1024;
+
+  struct Chunk {
+    std::unique_ptr<uint8_t[]> data;
+    size_t size;
+  };
+
+  std::vector<Chunk> _chunks;
+  // Offset of the next free byte in the last chunk
+  size_t _offset = 0;
+  size_t _bytesUsed = 0;
+  size_t _bytesReserved = 0;
+};
+
+} // namespace vision
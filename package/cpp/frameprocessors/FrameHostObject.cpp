@@ -0,0 +1,292 @@
+//
+//  FrameHostObject.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameHostObject.h"
+
+#include "ArrayBufferPool.h"
+#include "FrameMethodCache.h"
+#include "FramePlane.h"
+#include "FrameProperty.h"
+#include "FrameResize.h"
+#include "ImageRotation.h"
+#include "LockedBufferView.h"
+#include "PixelConversion.h"
+
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+FrameHostObject::FrameHostObject(std::shared_ptr<NativeFrame> frame)
+    : _frame(std::move(frame)), _refCount([this]() { _frame->retain(); }, [this]() { _frame->release(); }), _baseClass(nullptr) {}
+
+void FrameHostObject::assertIsValid(jsi::Runtime& runtime) const {
+  if (!getIsValid()) {
+    throw jsi::JSError(runtime, "[capture/frame-invalid] Trying to access an already closed Frame! "
+                                "Are you trying to access the Image data outside of a Frame Processor's lifetime?\n"
+                                "- If you want to use `console.log(frame)`, use `console.log(frame.toString())` instead.\n"
+                                "- If you want to do async processing, use `runAsync(...)` instead.\n"
+                                "- If you want to use runOnJS, increment it's ref-count: `frame.incrementRefCount()`");
+  }
+}
+
+std::vector<jsi::PropNameID> FrameHostObject::getPropertyNames(jsi::Runtime& rt) {
+  const auto& names = FramePropertyNames::forRuntime(rt);
+  return names.getPropertyNames(rt, getIsValid());
+}
+
+/**
+ * Parses the `copy` option of `toArrayBuffer(..)`/`getPlanes(..)`, which defaults to `true`.
+ */
+static bool getCopyOption(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count) {
+  if (count > 0 && arguments[0].isObject()) {
+    jsi::Value copyValue = arguments[0].getObject(runtime).getProperty(runtime, "copy");
+    if (copyValue.isBool()) {
+      return copyValue.getBool();
+    }
+  }
+  return true;
+}
+
+/**
+ * Parses the `pixelFormat` option of `toArrayBuffer(..)`, or `std::nullopt` if the Frame should be returned as-is.
+ */
+static std::optional<PixelLayout> getPixelFormatOption(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count) {
+  if (count > 0 && arguments[0].isObject()) {
+    jsi::Value pixelFormatValue = arguments[0].getObject(runtime).getProperty(runtime, "pixelFormat");
+    if (pixelFormatValue.isString()) {
+      std::string pixelFormat = pixelFormatValue.getString(runtime).utf8(runtime);
+      auto layout = parsePixelLayout(pixelFormat);
+      if (!layout.has_value()) {
+        throw jsi::JSError(runtime, "Frame.toArrayBuffer(): Invalid pixelFormat \"" + pixelFormat + "\"!");
+      }
+      return layout;
+    }
+  }
+  return std::nullopt;
+}
+
+#define JSI_FUNC [method](jsi::Runtime & runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value
+
+jsi::Value FrameHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  const auto& names = FramePropertyNames::forRuntime(runtime);
+  auto property = names.find(runtime, propName);
+
+  if (!property.has_value()) {
+    if (_baseClass != nullptr) {
+      // look up value in base class if we have a custom base class
+      jsi::Value value = _baseClass->getProperty(runtime, propName);
+      if (!value.isUndefined()) {
+        return value;
+      }
+    }
+
+    // fallback to base implementation
+    return HostObject::get(runtime, propName);
+  }
+
+  const FrameMetadata& metadata = getMetadata();
+  switch (property.value()) {
+    // Properties
+    case FrameProperty::IsValid:
+      return jsi::Value(getIsValid());
+    case FrameProperty::Width:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.width);
+    case FrameProperty::Height:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.height);
+    case FrameProperty::IsMirrored:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.isMirrored);
+    case FrameProperty::Orientation:
+      assertIsValid(runtime);
+      return jsi::String::createFromAscii(runtime, getOrientationUnionValue(metadata.orientation));
+    case FrameProperty::PixelFormat:
+      assertIsValid(runtime);
+      return jsi::String::createFromAscii(runtime, getPixelFormatUnionValue(metadata.pixelFormat));
+    case FrameProperty::Timestamp:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.timestamp);
+    case FrameProperty::BytesPerRow:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.bytesPerRow);
+    case FrameProperty::PlanesCount:
+      assertIsValid(runtime);
+      return jsi::Value(metadata.planesCount);
+
+    // Methods
+    case FrameProperty::IncrementRefCount:
+    case FrameProperty::DecrementRefCount:
+    case FrameProperty::GetNativeBuffer:
+    case FrameProperty::ToArrayBuffer:
+    case FrameProperty::GetPlanes:
+    case FrameProperty::Resize:
+    case FrameProperty::ToString:
+    case FrameProperty::WithBaseClass: {
+      auto method = property.value();
+      return FrameMethodCache::forRuntime(runtime).getOrCreate(runtime, method, [&]() { return createMethod(runtime, method); });
+    }
+  }
+
+  return jsi::Value::undefined();
+}
+
+jsi::Function FrameHostObject::createMethod(jsi::Runtime& runtime, FrameProperty method) {
+  const auto& names = FramePropertyNames::forRuntime(runtime);
+
+  switch (method) {
+    // Internal Methods
+    case FrameProperty::IncrementRefCount: {
+      jsi::HostFunctionType incrementRefCount = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        // Increment retain count by one. This only touches the native ref-count.
+        hostObject->_refCount.retain();
+        return jsi::Value::undefined();
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::IncrementRefCount), 0, incrementRefCount);
+    }
+    case FrameProperty::DecrementRefCount: {
+      auto decrementRefCount = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        // Decrement retain count by one. If the retain count is zero, the Frame gets closed.
+        hostObject->_refCount.release();
+        return jsi::Value::undefined();
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::DecrementRefCount), 0, decrementRefCount);
+    }
+
+    // Conversion methods
+    case FrameProperty::GetNativeBuffer: {
+      jsi::HostFunctionType getNativeBuffer = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        hostObject->assertIsValid(runtime);
+        NativeBuffer nativeBuffer = hostObject->_frame->getNativeBuffer();
+        auto release = std::move(nativeBuffer.release);
+        jsi::HostFunctionType deleteFunc = [release](jsi::Runtime& runtime, const jsi::Value& thisArg, const jsi::Value* args,
+                                                     size_t count) -> jsi::Value {
+          if (release != nullptr) {
+            release();
+          }
+          return jsi::Value::undefined();
+        };
+
+        jsi::Object buffer(runtime);
+        buffer.setProperty(runtime, "pointer", jsi::BigInt::fromUint64(runtime, nativeBuffer.pointer));
+        buffer.setProperty(runtime, "delete",
+                           jsi::Function::createFromHostFunction(runtime, jsi::PropNameID::forUtf8(runtime, "delete"), 0, deleteFunc));
+        return buffer;
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::GetNativeBuffer), 0, getNativeBuffer);
+    }
+    case FrameProperty::ToArrayBuffer: {
+      jsi::HostFunctionType toArrayBuffer = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        hostObject->assertIsValid(runtime);
+        NativeFrame& frame = *hostObject->_frame;
+        bool copy = getCopyOption(runtime, arguments, count);
+
+        auto pixelFormat = getPixelFormatOption(runtime, arguments, count);
+        auto orientation = parseOrientationOptions(runtime, arguments, count, frame.getMetadata().orientation, "Frame.toArrayBuffer()");
+        if (!orientation.isIdentity() && !pixelFormat.has_value()) {
+          throw jsi::JSError(runtime, "Frame.toArrayBuffer(): `orientation` and `mirror` can only be used together with `pixelFormat`!");
+        }
+        if (pixelFormat.has_value()) {
+          // Convert into a tightly packed buffer
+          std::shared_ptr<void> lock;
+          auto planes = frame.lockPlanes(lock);
+          auto convertedBuffer = convertFramePlanes(planes, frame.getPackedLayout(), frame.getIsFullRange(), pixelFormat.value());
+          if (!orientation.isIdentity()) {
+            size_t bytesPerPixel = getBytesPerPixel(pixelFormat.value());
+            convertedBuffer = ImageRotation::rotateToPooledBuffer(convertedBuffer->data(), planes[0].width, planes[0].height,
+                                                                  planes[0].width * bytesPerPixel, bytesPerPixel, orientation);
+          }
+          return jsi::ArrayBuffer(runtime, convertedBuffer);
+        }
+
+        std::shared_ptr<void> lock;
+        size_t size = 0;
+        uint8_t* buffer = frame.lockBuffer(lock, size);
+
+        if (!copy) {
+          // Zero-copy: point the ArrayBuffer directly at the locked platform buffer.
+          // It stays locked until the ArrayBuffer gets garbage-collected.
+          auto view = std::make_shared<LockedBufferView>(std::move(lock), buffer, size);
+          return jsi::ArrayBuffer(runtime, view);
+        }
+
+        // Get a distinct buffer from the pool, so ArrayBuffers of previous Frames that are still alive don't get overwritten
+        auto mutableBuffer = ArrayBufferPool::getSharedInstance()->acquire(size);
+        memcpy(mutableBuffer->data(), buffer, size);
+        return jsi::ArrayBuffer(runtime, mutableBuffer);
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::ToArrayBuffer), 1, toArrayBuffer);
+    }
+    case FrameProperty::GetPlanes: {
+      jsi::HostFunctionType getPlanes = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        hostObject->assertIsValid(runtime);
+        bool copy = getCopyOption(runtime, arguments, count);
+
+        std::shared_ptr<void> lock;
+        auto planes = hostObject->_frame->lockPlanes(lock);
+
+        return createFramePlanesArray(runtime, planes, lock, copy);
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::GetPlanes), 1, getPlanes);
+    }
+    case FrameProperty::Resize: {
+      jsi::HostFunctionType resize = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        hostObject->assertIsValid(runtime);
+        NativeFrame& frame = *hostObject->_frame;
+
+        std::shared_ptr<void> lock;
+        auto planes = frame.lockPlanes(lock);
+        auto options = parseResizeOptions(runtime, arguments, count, planes[0].width, planes[0].height, frame.getMetadata().orientation);
+        auto buffer = resizeFramePlanes(planes, frame.getPackedLayout(), frame.getIsFullRange(), options);
+        return jsi::ArrayBuffer(runtime, buffer);
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::Resize), 1, resize);
+    }
+    case FrameProperty::ToString: {
+      jsi::HostFunctionType toString = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        if (!hostObject->getIsValid()) {
+          return jsi::String::createFromUtf8(runtime, "[closed frame]");
+        }
+        const auto& metadata = hostObject->getMetadata();
+        auto str = std::to_string(metadata.width) + " x " + std::to_string(metadata.height) + " " +
+                   getPixelFormatUnionValue(metadata.pixelFormat) + " Frame";
+        return jsi::String::createFromUtf8(runtime, str);
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::ToString), 0, toString);
+    }
+    case FrameProperty::WithBaseClass: {
+      auto withBaseClass = JSI_FUNC {
+        auto hostObject = getFrameFromThis<FrameHostObject>(runtime, thisValue, method);
+        jsi::Object newBaseClass = arguments[0].asObject(runtime);
+        hostObject->_baseClass = std::make_unique<jsi::Object>(std::move(newBaseClass));
+        return jsi::Object::createFromHostObject(runtime, hostObject);
+      };
+      return jsi::Function::createFromHostFunction(runtime, names.get(FrameProperty::WithBaseClass), 1, withBaseClass);
+    }
+    default:
+      throw std::runtime_error(std::string("FrameProperty \"") + getFramePropertyName(method) + "\" is not a method!");
+  }
+}
+
+#undef JSI_FUNC
+
+} // namespace vision
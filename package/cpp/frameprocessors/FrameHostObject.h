@@ -0,0 +1,79 @@
+//
+//  FrameHostObject.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include "FrameMetadata.h"
+#include "FrameProperty.h"
+#include "FrameRefCount.h"
+#include "NativeFrame.h"
+
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * The `Frame` object Frame Processors are called with.
+ *
+ * All platform-specific access (locking the buffer, ref-counting the platform Frame) goes through the `NativeFrame`
+ * this wraps - a `PlatformFrame` on Android and iOS, or e.g. a `SyntheticFrame` on the host.
+ */
+class JSI_EXPORT FrameHostObject : public jsi::HostObject, public std::enable_shared_from_this<FrameHostObject> {
+public:
+  explicit FrameHostObject(std::shared_ptr<NativeFrame> frame);
+
+public:
+  jsi::Value get(jsi::Runtime&, const jsi::PropNameID& name) override;
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& rt) override;
+
+public:
+  inline const std::shared_ptr<NativeFrame>& getNativeFrame() const noexcept {
+    return _frame;
+  }
+  inline const FrameMetadata& getMetadata() const noexcept {
+    return _frame->getMetadata();
+  }
+  inline bool getIsValid() const noexcept {
+    return _refCount.isValid() && _frame->getIsValid();
+  }
+
+  /**
+   * Holds an additional reference on this Frame, e.g. while native Threads work on it.
+   * Returns `false` if the Frame has already been released. Balance every successful call with `release()`.
+   */
+  inline bool retain() noexcept {
+    return _refCount.retain();
+  }
+  inline void release() {
+    _refCount.release();
+  }
+
+  /**
+   * Releases the reference the Frame Processor pipeline holds on this Frame while the Frame Processor is running.
+   * Call this once the Frame Processor returned.
+   */
+  inline void onFrameProcessorFinished() {
+    _refCount.releaseBorrowedReference();
+  }
+
+private:
+  void assertIsValid(jsi::Runtime& runtime) const;
+  static jsi::Function createMethod(jsi::Runtime& runtime, FrameProperty method);
+
+private:
+  std::shared_ptr<NativeFrame> _frame;
+  FrameRefCount _refCount;
+  std::unique_ptr<jsi::Object> _baseClass;
+};
+
+} // namespace vision
@@ -0,0 +1,79 @@
+//
+//  FrameMetadata.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <cstdint>
+
+namespace vision {
+
+/**
+ * The orientation of a Frame, in the same order as the native `Orientation` enums.
+ */
+enum class FrameOrientation : uint8_t {
+  Portrait,
+  LandscapeRight,
+  PortraitUpsideDown,
+  LandscapeLeft,
+};
+
+/**
+ * The pixel format of a Frame, in the same order as the native `PixelFormat` enums.
+ */
+enum class FramePixelFormat : uint8_t {
+  YUV,
+  RGB,
+  Unknown,
+};
+
+inline const char* getOrientationUnionValue(FrameOrientation orientation) {
+  switch (orientation) {
+    case FrameOrientation::Portrait:
+      return "portrait";
+    case FrameOrientation::LandscapeRight:
+      return "landscape-right";
+    case FrameOrientation::PortraitUpsideDown:
+      return "portrait-upside-down";
+    case FrameOrientation::LandscapeLeft:
+      return "landscape-left";
+  }
+  return "portrait";
+}
+
+inline const char* getPixelFormatUnionValue(FramePixelFormat pixelFormat) {
+  switch (pixelFormat) {
+    case FramePixelFormat::YUV:
+      return "yuv";
+    case FramePixelFormat::RGB:
+      return "rgb";
+    case FramePixelFormat::Unknown:
+      return "unknown";
+  }
+  return "unknown";
+}
+
+/**
+ * A snapshot of all metadata of a Frame.
+ *
+ * This is filled once when the Frame is handed to the Frame Processor, so reading
+ * properties such as `width` or `orientation` from JS is a plain field access
+ * instead of a call into the platform's Frame.
+ */
+struct FrameMetadata {
+  int32_t width;
+  int32_t height;
+  int32_t bytesPerRow;
+  int32_t planesCount;
+  // Timestamp as it is exposed to JS (nanoseconds on Android, milliseconds on iOS)
+  double timestamp;
+  FrameOrientation orientation;
+  FramePixelFormat pixelFormat;
+  bool isMirrored;
+};
+
+} // namespace vision
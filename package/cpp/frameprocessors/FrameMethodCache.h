@@ -0,0 +1,71 @@
+//
+//  FrameMethodCache.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include "FrameProperty.h"
+#include "RuntimeCache.h"
+
+#include <array>
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * Holds the `jsi::Function`s of all Frame methods (`toArrayBuffer`, `incrementRefCount`, ...) for one Runtime.
+ *
+ * All Frames of a Runtime share the same method instances, and methods resolve the Frame they operate on
+ * through `thisValue` (see `getFrameFromThis`). This way accessing a method does not allocate a new
+ * `jsi::Function` for every Frame.
+ */
+class FrameMethodCache {
+public:
+  explicit FrameMethodCache(jsi::Runtime&) {}
+
+  static FrameMethodCache& forRuntime(jsi::Runtime& runtime) {
+    return RuntimeCache<FrameMethodCache>::get(runtime);
+  }
+
+public:
+  /**
+   * Get the cached method for the given `FrameProperty`, or create it using `createMethod()` if it was not yet cached.
+   */
+  template <typename CreateMethod> jsi::Value getOrCreate(jsi::Runtime& runtime, FrameProperty method, CreateMethod&& createMethod) {
+    auto& function = _methods[static_cast<size_t>(method)];
+    if (function == nullptr) {
+      function = std::make_unique<jsi::Function>(createMethod());
+    }
+    return jsi::Value(runtime, *function);
+  }
+
+private:
+  std::array<std::unique_ptr<jsi::Function>, kFramePropertyCount> _methods;
+};
+
+/**
+ * Get the `FrameHostObject` a cached Frame method has been called on.
+ * Throws a JS error if `thisValue` is not a Frame, e.g. if the method has been destructured from the Frame.
+ */
+template <typename TFrameHostObject>
+std::shared_ptr<TFrameHostObject> getFrameFromThis(jsi::Runtime& runtime, const jsi::Value& thisValue, FrameProperty method) {
+  if (thisValue.isObject()) {
+    jsi::Object object = thisValue.getObject(runtime);
+    if (object.isHostObject<TFrameHostObject>(runtime)) {
+      return object.getHostObject<TFrameHostObject>(runtime);
+    }
+  }
+  throw jsi::JSError(runtime, std::string("Frame.") + getFramePropertyName(method) + "() has to be called on a Frame!");
+}
+
+} // namespace vision
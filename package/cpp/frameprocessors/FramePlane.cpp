@@ -0,0 +1,96 @@
+//
+//  FramePlane.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FramePlane.h"
+#include "ArrayBufferPool.h"
+#include "LockedBufferView.h"
+
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+jsi::Array createFramePlanesArray(jsi::Runtime& runtime, const std::vector<FramePlane>& planes, const std::shared_ptr<void>& lock,
+                                  bool copy) {
+  jsi::Array result(runtime, planes.size());
+  const uint8_t* firstPlane = planes.empty() ? nullptr : planes[0].data;
+
+  for (size_t i = 0; i < planes.size(); i++) {
+    const FramePlane& plane = planes[i];
+    size_t size = plane.getSize();
+
+    std::shared_ptr<jsi::MutableBuffer> buffer;
+    if (copy) {
+      auto pooledBuffer = ArrayBufferPool::getSharedInstance()->acquire(size);
+      memcpy(pooledBuffer->data(), plane.data, size);
+      buffer = pooledBuffer;
+    } else {
+      buffer = std::make_shared<LockedBufferView>(lock, plane.data, size);
+    }
+
+    jsi::Object object(runtime);
+    object.setProperty(runtime, "width", plane.width);
+    object.setProperty(runtime, "height", plane.height);
+    object.setProperty(runtime, "bytesPerRow", plane.bytesPerRow);
+    object.setProperty(runtime, "pixelStride", plane.pixelStride);
+    object.setProperty(runtime, "offset", static_cast<double>(plane.data - firstPlane));
+    object.setProperty(runtime, "buffer", jsi::ArrayBuffer(runtime, buffer));
+    result.setValueAtIndex(runtime, i, std::move(object));
+  }
+
+  return result;
+}
+
+std::shared_ptr<MutableRawBuffer> convertFramePlanes(const std::vector<FramePlane>& planes, PixelLayout packedLayout, bool isFullRange,
+                                                     PixelLayout layout) {
+  if (planes.empty()) {
+    throw std::runtime_error("Cannot convert a Frame without any planes!");
+  }
+  const FramePlane& firstPlane = planes[0];
+  size_t destinationBytesPerRow = static_cast<size_t>(firstPlane.width) * getBytesPerPixel(layout);
+  auto buffer = ArrayBufferPool::getSharedInstance()->acquire(destinationBytesPerRow * firstPlane.height);
+
+  if (planes.size() == 1 && firstPlane.pixelStride == 4) {
+    // Packed RGBA/BGRA
+    PackedImageView source;
+    source.width = firstPlane.width;
+    source.height = firstPlane.height;
+    source.data = firstPlane.data;
+    source.bytesPerRow = firstPlane.bytesPerRow;
+    source.layout = packedLayout;
+    PixelConversion::convert(source, buffer->data(), destinationBytesPerRow, layout);
+    return buffer;
+  }
+
+  if ((planes.size() == 2 || planes.size() == 3) && firstPlane.pixelStride == 1) {
+    // YUV 4:2:0, either planar/semi-planar in 3 planes (Android), or Y + interleaved CbCr in 2 planes (iOS)
+    const FramePlane& uPlane = planes[1];
+    YUVImageView source;
+    source.width = firstPlane.width;
+    source.height = firstPlane.height;
+    source.y = firstPlane.data;
+    source.yBytesPerRow = firstPlane.bytesPerRow;
+    source.u = uPlane.data;
+    source.v = planes.size() == 3 ? planes[2].data : uPlane.data + 1;
+    source.uvBytesPerRow = uPlane.bytesPerRow;
+    source.uvPixelStride = uPlane.pixelStride;
+    source.isFullRange = isFullRange;
+    PixelConversion::convert(source, buffer->data(), destinationBytesPerRow, layout);
+    return buffer;
+  }
+
+  throw std::runtime_error("Cannot convert a Frame with " + std::to_string(planes.size()) + " planes and a pixel stride of " +
+                           std::to_string(firstPlane.pixelStride) + " - only 8-bit YUV 4:2:0 and RGB Frames can be converted!");
+}
+
+} // namespace vision
@@ -0,0 +1,69 @@
+//
+//  FramePlane.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "MutableRawBuffer.h"
+#include "PixelConversion.h"
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A single plane of a locked platform buffer (e.g. the Y or the CbCr plane of a YUV Frame).
+ */
+struct FramePlane {
+  // Address of the first pixel of this plane in the locked buffer
+  uint8_t* data;
+  // Width and height of this plane in pixels (chroma planes are subsampled)
+  int32_t width;
+  int32_t height;
+  // Distance between the start of two rows in bytes
+  int32_t bytesPerRow;
+  // Distance between two pixels of a row in bytes
+  int32_t pixelStride;
+
+  /**
+   * The number of bytes that can be read from `data` - the last row is not padded to `bytesPerRow`.
+   */
+  inline size_t getSize() const {
+    if (height <= 0) {
+      return 0;
+    }
+    return static_cast<size_t>(bytesPerRow) * (height - 1) + static_cast<size_t>(width) * pixelStride;
+  }
+};
+
+/**
+ * Creates the JS array returned by `Frame.getPlanes()`.
+ *
+ * If `copy` is `true`, every plane is copied into a pooled `ArrayBuffer` and `lock` is no longer needed after
+ * this returns. Otherwise the `ArrayBuffer`s point directly at the planes and share ownership of `lock`,
+ * which keeps the platform buffer locked until all of them have been garbage-collected.
+ */
+jsi::Array createFramePlanesArray(jsi::Runtime& runtime, const std::vector<FramePlane>& planes, const std::shared_ptr<void>& lock,
+                                  bool copy);
+
+/**
+ * Converts the planes of an 8-bit YUV 4:2:0 (3 planes, or 2 planes with interleaved CbCr) or a packed 4-channel
+ * Frame (1 plane) into a pooled, tightly packed buffer of the given `layout`, used for `Frame.toArrayBuffer({ pixelFormat })`.
+ *
+ * `packedLayout` is the channel order of packed Frames (`RGBA` or `BGRA`), and `isFullRange` the range of YUV Frames.
+ * Throws a `std::runtime_error` if the plane configuration is not supported.
+ */
+std::shared_ptr<MutableRawBuffer> convertFramePlanes(const std::vector<FramePlane>& planes, PixelLayout packedLayout, bool isFullRange,
+                                                     PixelLayout layout);
+
+} // namespace vision
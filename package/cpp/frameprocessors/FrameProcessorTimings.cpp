@@ -0,0 +1,67 @@
+//
+//  FrameProcessorTimings.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameProcessorTimings.h"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+namespace FrameProcessorTimings {
+
+  // All histograms are leaked on purpose, so they can still be recorded into while static destructors run.
+
+  LatencyHistogram& getFrameProcessorHistogram() {
+    static LatencyHistogram* histogram = new LatencyHistogram();
+    return *histogram;
+  }
+
+  LatencyHistogram& getArgumentConversionHistogram() {
+    static LatencyHistogram* histogram = new LatencyHistogram();
+    return *histogram;
+  }
+
+  LatencyHistogram& getResultConversionHistogram() {
+    static LatencyHistogram* histogram = new LatencyHistogram();
+    return *histogram;
+  }
+
+  struct PluginHistograms {
+    std::mutex mutex;
+    std::map<std::string, std::shared_ptr<LatencyHistogram>> histograms;
+  };
+
+  static PluginHistograms& getPluginHistogramsRegistry() {
+    static PluginHistograms* registry = new PluginHistograms();
+    return *registry;
+  }
+
+  std::shared_ptr<LatencyHistogram> getPluginHistogram(const std::string& pluginName) {
+    auto& registry = getPluginHistogramsRegistry();
+    std::unique_lock lock(registry.mutex);
+    auto& histogram = registry.histograms[pluginName];
+    if (histogram == nullptr) {
+      histogram = std::make_shared<LatencyHistogram>();
+    }
+    return histogram;
+  }
+
+  std::vector<std::pair<std::string, std::shared_ptr<LatencyHistogram>>> getPluginHistograms() {
+    auto& registry = getPluginHistogramsRegistry();
+    std::unique_lock lock(registry.mutex);
+    return std::vector<std::pair<std::string, std::shared_ptr<LatencyHistogram>>>(registry.histograms.begin(), registry.histograms.end());
+  }
+
+} // namespace FrameProcessorTimings
+
+} // namespace vision
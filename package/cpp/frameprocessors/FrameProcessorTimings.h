@@ -0,0 +1,49 @@
+//
+//  FrameProcessorTimings.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "LatencyHistogram.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+/**
+ * Timings of the Frame Processor hot paths, exposed to JS as `VisionCameraProxy.getStats().timings`.
+ */
+namespace FrameProcessorTimings {
+
+  /**
+   * The time a Frame Processor worklet takes per Frame, including all Plugin calls.
+   */
+  LatencyHistogram& getFrameProcessorHistogram();
+  /**
+   * The time it takes to convert (or look up) the options passed to a Plugin.
+   */
+  LatencyHistogram& getArgumentConversionHistogram();
+  /**
+   * The time it takes to convert the result of a Plugin to JS.
+   */
+  LatencyHistogram& getResultConversionHistogram();
+  /**
+   * Get the histogram of the native `callback` of the Plugin with the given name.
+   * All instances of a Plugin share one histogram. Look it up once (e.g. when the Plugin is created), not per call.
+   */
+  std::shared_ptr<LatencyHistogram> getPluginHistogram(const std::string& pluginName);
+  /**
+   * Get the histograms of all Plugins that have been created so far.
+   */
+  std::vector<std::pair<std::string, std::shared_ptr<LatencyHistogram>>> getPluginHistograms();
+
+} // namespace FrameProcessorTimings
+
+} // namespace vision
@@ -0,0 +1,96 @@
+//
+//  FrameProperty.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameProperty.h"
+#include "RuntimeCache.h"
+
+#include <jsi/jsi.h>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+const char* getFramePropertyName(FrameProperty property) {
+  switch (property) {
+    case FrameProperty::IncrementRefCount:
+      return "incrementRefCount";
+    case FrameProperty::DecrementRefCount:
+      return "decrementRefCount";
+    case FrameProperty::IsValid:
+      return "isValid";
+    case FrameProperty::Width:
+      return "width";
+    case FrameProperty::Height:
+      return "height";
+    case FrameProperty::BytesPerRow:
+      return "bytesPerRow";
+    case FrameProperty::PlanesCount:
+      return "planesCount";
+    case FrameProperty::Orientation:
+      return "orientation";
+    case FrameProperty::IsMirrored:
+      return "isMirrored";
+    case FrameProperty::Timestamp:
+      return "timestamp";
+    case FrameProperty::PixelFormat:
+      return "pixelFormat";
+    case FrameProperty::ToString:
+      return "toString";
+    case FrameProperty::ToArrayBuffer:
+      return "toArrayBuffer";
+    case FrameProperty::GetPlanes:
+      return "getPlanes";
+    case FrameProperty::Resize:
+      return "resize";
+    case FrameProperty::GetNativeBuffer:
+      return "getNativeBuffer";
+    case FrameProperty::WithBaseClass:
+      return "withBaseClass";
+  }
+  return "unknown";
+}
+
+FramePropertyNames::FramePropertyNames(jsi::Runtime& runtime) {
+  _names.reserve(kFramePropertyCount);
+  for (size_t i = 0; i < kFramePropertyCount; i++) {
+    auto property = static_cast<FrameProperty>(i);
+    _names.push_back(jsi::PropNameID::forAscii(runtime, getFramePropertyName(property)));
+  }
+}
+
+const FramePropertyNames& FramePropertyNames::forRuntime(jsi::Runtime& runtime) {
+  return RuntimeCache<FramePropertyNames>::get(runtime);
+}
+
+std::optional<FrameProperty> FramePropertyNames::find(jsi::Runtime& runtime, const jsi::PropNameID& name) const {
+  // FrameProperty is ordered by how often a property is accessed, ref-counting happens on every Frame.
+  for (size_t i = 0; i < kFramePropertyCount; i++) {
+    if (jsi::PropNameID::compare(runtime, _names[i], name)) {
+      return static_cast<FrameProperty>(i);
+    }
+  }
+  return std::nullopt;
+}
+
+const jsi::PropNameID& FramePropertyNames::get(FrameProperty property) const {
+  return _names[static_cast<size_t>(property)];
+}
+
+std::vector<jsi::PropNameID> FramePropertyNames::getPropertyNames(jsi::Runtime& runtime, bool isValid) const {
+  // Ref Management is always available, everything else only as long as the Frame is valid.
+  size_t count = isValid ? kFramePropertyCount : static_cast<size_t>(FrameProperty::IsValid) + 1;
+  std::vector<jsi::PropNameID> result;
+  result.reserve(count);
+  for (size_t i = 0; i < count; i++) {
+    result.push_back(jsi::PropNameID(runtime, _names[i]));
+  }
+  return result;
+}
+
+} // namespace vision
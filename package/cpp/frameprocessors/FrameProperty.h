@@ -0,0 +1,88 @@
+//
+//  FrameProperty.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <optional>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * All properties and methods a `FrameHostObject` exposes to JS.
+ */
+enum class FrameProperty {
+  // Ref Management
+  IncrementRefCount,
+  DecrementRefCount,
+  IsValid,
+  // Frame Properties
+  Width,
+  Height,
+  BytesPerRow,
+  PlanesCount,
+  Orientation,
+  IsMirrored,
+  Timestamp,
+  PixelFormat,
+  // Conversion
+  ToString,
+  ToArrayBuffer,
+  GetPlanes,
+  Resize,
+  GetNativeBuffer,
+  WithBaseClass,
+};
+
+static constexpr size_t kFramePropertyCount = static_cast<size_t>(FrameProperty::WithBaseClass) + 1;
+
+/**
+ * Returns the JS name of the given `FrameProperty`.
+ */
+const char* getFramePropertyName(FrameProperty property);
+
+/**
+ * A table of pre-interned `jsi::PropNameID`s for all `FrameProperty`s of one `jsi::Runtime`.
+ *
+ * `FrameHostObject::get(..)` is called multiple times per Frame, so instead of converting every accessed
+ * property name to a UTF-8 `std::string` and comparing it against all known names, we compare the
+ * `jsi::PropNameID` against the interned names, which is a cheap identity check in the JS engine.
+ */
+class FramePropertyNames {
+public:
+  explicit FramePropertyNames(jsi::Runtime& runtime);
+
+  /**
+   * Get the `FramePropertyNames` table for the given Runtime. It is created once per Runtime.
+   */
+  static const FramePropertyNames& forRuntime(jsi::Runtime& runtime);
+
+public:
+  /**
+   * Find the `FrameProperty` the given `jsi::PropNameID` refers to, or `std::nullopt` if it is not a Frame property.
+   */
+  std::optional<FrameProperty> find(jsi::Runtime& runtime, const jsi::PropNameID& name) const;
+  /**
+   * Get the interned `jsi::PropNameID` of the given `FrameProperty`.
+   */
+  const jsi::PropNameID& get(FrameProperty property) const;
+  /**
+   * Create the list of property names a `FrameHostObject` exposes.
+   * If the Frame is no longer valid, only ref-management properties are returned.
+   */
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime, bool isValid) const;
+
+private:
+  std::vector<jsi::PropNameID> _names;
+};
+
+} // namespace vision
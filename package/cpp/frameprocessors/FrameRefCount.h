@@ -0,0 +1,124 @@
+//
+//  FrameRefCount.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace vision {
+
+/**
+ * A lock-free ref-count for a Frame that is shared between the Frame Processor, `runAsync` and JS threads.
+ *
+ * The count starts at 1, which is the reference the Frame Processor pipeline holds on the platform Frame
+ * (`ImageProxy` / `CMSampleBuffer`) while the Frame Processor is running. All `incrementRefCount()` and
+ * `decrementRefCount()` calls from JS only touch the atomic counter.
+ *
+ * The platform Frame is only retained if JS still holds references once the Frame Processor returned,
+ * and it is released again as soon as the count reaches zero.
+ */
+class FrameRefCount {
+public:
+  using PlatformCallback = std::function<void()>;
+
+  FrameRefCount(PlatformCallback retainPlatformFrame, PlatformCallback releasePlatformFrame)
+      : _count(1), _ownsPlatformReference(false), _retainPlatformFrame(std::move(retainPlatformFrame)),
+        _releasePlatformFrame(std::move(releasePlatformFrame)) {}
+
+  FrameRefCount(const FrameRefCount&) = delete;
+  FrameRefCount& operator=(const FrameRefCount&) = delete;
+
+public:
+  /**
+   * Whether anyone still holds a reference on this Frame.
+   */
+  inline bool isValid() const noexcept {
+    return _count.load(std::memory_order_acquire) > 0;
+  }
+
+  /**
+   * Increment the ref-count by one.
+   * Returns `false` if the Frame has already been released, in which case it stays invalid.
+   */
+  bool retain() noexcept {
+    int32_t count = _count.load(std::memory_order_acquire);
+    do {
+      if (count <= 0) {
+        return false;
+      }
+    } while (!_count.compare_exchange_weak(count, count + 1, std::memory_order_acq_rel, std::memory_order_acquire));
+    return true;
+  }
+
+  /**
+   * Decrement the ref-count by one, and release the platform Frame if it was the last reference.
+   */
+  void release() {
+    if (decrement() == 1) {
+      onReleased();
+    }
+  }
+
+  /**
+   * Releases the reference the Frame Processor pipeline holds while the Frame Processor is running.
+   * Call this once the Frame Processor returned, right before the pipeline releases its own platform reference.
+   */
+  void releaseBorrowedReference() {
+    int32_t expected = 1;
+    if (_count.compare_exchange_strong(expected, 0, std::memory_order_acq_rel, std::memory_order_acquire)) {
+      // Nobody else holds a reference, the pipeline closes the platform Frame.
+      return;
+    }
+    if (expected <= 0) {
+      // JS over-released the Frame, it is already invalid.
+      return;
+    }
+
+    // JS still holds references after the Frame Processor returned (e.g. `runAsync`),
+    // so keep the platform Frame alive until those are released.
+    _retainPlatformFrame();
+    _ownsPlatformReference.store(true, std::memory_order_release);
+    int32_t previous = decrement();
+    if (previous == 1 || previous == 0) {
+      // Either this was the last reference, or JS over-released in the meantime.
+      onReleased();
+    }
+  }
+
+private:
+  /**
+   * Decrements the count without going below zero, and returns the previous count.
+   */
+  int32_t decrement() noexcept {
+    int32_t count = _count.load(std::memory_order_acquire);
+    do {
+      if (count <= 0) {
+        return 0;
+      }
+    } while (!_count.compare_exchange_weak(count, count - 1, std::memory_order_acq_rel, std::memory_order_acquire));
+    return count;
+  }
+
+  void onReleased() {
+    // Only release the platform Frame if we retained it, and only ever once.
+    if (_ownsPlatformReference.exchange(false, std::memory_order_acq_rel)) {
+      _releasePlatformFrame();
+    }
+  }
+
+private:
+  std::atomic<int32_t> _count;
+  std::atomic<bool> _ownsPlatformReference;
+  PlatformCallback _retainPlatformFrame;
+  PlatformCallback _releasePlatformFrame;
+};
+
+} // namespace vision
@@ -0,0 +1,449 @@
+//
+//  FrameResize.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameResize.h"
+#include "ArrayBufferPool.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+size_t ResizeOptions::getSize() const {
+  size_t bytesPerChannel = dataType == ResizeDataType::Float32 ? sizeof(float) : sizeof(uint8_t);
+  return static_cast<size_t>(width) * height * getBytesPerPixel(layout) * bytesPerChannel;
+}
+
+// Upper bounds for the target size, so a typo in JS can't allocate gigabytes (4096 x 4096 RGB float32 is already 192 MB)
+static constexpr int32_t kMaxTargetSize = 8192;
+static constexpr size_t kMaxTargetBytes = 256 * 1024 * 1024;
+
+static int32_t getIntProperty(jsi::Runtime& runtime, const jsi::Object& object, const char* name, const char* path, int32_t min,
+                              int32_t max) {
+  jsi::Value value = object.getProperty(runtime, name);
+  if (!value.isNumber()) {
+    throw jsi::JSError(runtime, std::string("Frame.resize(): `") + path + "` has to be a number!");
+  }
+  // Casting NaN, Infinity or out-of-range doubles to an integer is undefined behaviour, so they are rejected first.
+  double number = value.getNumber();
+  if (!std::isfinite(number) || std::trunc(number) != number) {
+    throw jsi::JSError(runtime, std::string("Frame.resize(): `") + path + "` has to be an integer!");
+  }
+  if (number < min || number > max) {
+    throw jsi::JSError(runtime, std::string("Frame.resize(): `") + path + "` has to be between " + std::to_string(min) + " and " +
+                                    std::to_string(max) + "!");
+  }
+  return static_cast<int32_t>(number);
+}
+
+static std::array<float, 3> getChannelValues(jsi::Runtime& runtime, const jsi::Object& options, const char* name, float defaultValue) {
+  jsi::Value value = options.getProperty(runtime, name);
+  if (value.isUndefined()) {
+    return {defaultValue, defaultValue, defaultValue};
+  }
+  if (value.isNumber()) {
+    float number = static_cast<float>(value.getNumber());
+    if (std::isfinite(number)) {
+      return {number, number, number};
+    }
+  }
+  if (value.isObject() && value.getObject(runtime).isArray(runtime)) {
+    jsi::Array array = value.getObject(runtime).getArray(runtime);
+    size_t length = array.size(runtime);
+    if (length == 1 || length == 3) {
+      std::array<float, 3> result;
+      bool isValid = true;
+      for (size_t i = 0; i < 3; i++) {
+        jsi::Value element = array.getValueAtIndex(runtime, length == 1 ? 0 : i);
+        isValid = isValid && element.isNumber() && std::isfinite(static_cast<float>(element.getNumber()));
+        result[i] = isValid ? static_cast<float>(element.getNumber()) : 0.0f;
+      }
+      if (isValid) {
+        return result;
+      }
+    }
+  }
+  throw jsi::JSError(runtime,
+                     std::string("Frame.resize(): `") + name + "` has to be a finite number, or an array of 1 or 3 finite numbers!");
+}
+
+ResizeOptions parseResizeOptions(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count, int32_t frameWidth, int32_t frameHeight,
+                                 FrameOrientation frameOrientation) {
+  if (count < 1 || !arguments[0].isObject()) {
+    throw jsi::JSError(runtime, "Frame.resize(): Expected an options object, e.g. `frame.resize({ width: 224, height: 224 })`!");
+  }
+  jsi::Object object = arguments[0].getObject(runtime);
+
+  ResizeOptions options;
+  options.width = getIntProperty(runtime, object, "width", "width", 1, kMaxTargetSize);
+  options.height = getIntProperty(runtime, object, "height", "height", 1, kMaxTargetSize);
+
+  jsi::Value cropValue = object.getProperty(runtime, "crop");
+  if (cropValue.isObject()) {
+    jsi::Object crop = cropValue.getObject(runtime);
+    options.cropX = getIntProperty(runtime, crop, "x", "crop.x", 0, frameWidth);
+    options.cropY = getIntProperty(runtime, crop, "y", "crop.y", 0, frameHeight);
+    options.cropWidth = getIntProperty(runtime, crop, "width", "crop.width", 0, frameWidth);
+    options.cropHeight = getIntProperty(runtime, crop, "height", "crop.height", 0, frameHeight);
+    if (options.cropWidth == 0 || options.cropHeight == 0 || options.cropX + options.cropWidth > frameWidth ||
+        options.cropY + options.cropHeight > frameHeight) {
+      throw jsi::JSError(runtime, "Frame.resize(): `crop` has to be a non-empty rectangle inside the Frame (" + std::to_string(frameWidth) +
+                                      " x " + std::to_string(frameHeight) + ")!");
+    }
+  } else {
+    options.cropX = 0;
+    options.cropY = 0;
+    options.cropWidth = frameWidth;
+    options.cropHeight = frameHeight;
+  }
+
+  options.layout = PixelLayout::RGB;
+  jsi::Value pixelFormatValue = object.getProperty(runtime, "pixelFormat");
+  if (pixelFormatValue.isString()) {
+    std::string pixelFormat = pixelFormatValue.getString(runtime).utf8(runtime);
+    auto layout = parsePixelLayout(pixelFormat);
+    if (!layout.has_value()) {
+      throw jsi::JSError(runtime, "Frame.resize(): Invalid pixelFormat \"" + pixelFormat + "\"!");
+    }
+    options.layout = layout.value();
+  }
+
+  options.dataType = ResizeDataType::Uint8;
+  jsi::Value dataTypeValue = object.getProperty(runtime, "dataType");
+  if (dataTypeValue.isString()) {
+    std::string dataType = dataTypeValue.getString(runtime).utf8(runtime);
+    if (dataType == "float32") {
+      options.dataType = ResizeDataType::Float32;
+    } else if (dataType != "uint8") {
+      throw jsi::JSError(runtime, "Frame.resize(): Invalid dataType \"" + dataType + "\"!");
+    }
+  }
+
+  options.interpolation = ResizeInterpolation::Bilinear;
+  jsi::Value interpolationValue = object.getProperty(runtime, "interpolation");
+  if (interpolationValue.isString()) {
+    std::string interpolation = interpolationValue.getString(runtime).utf8(runtime);
+    if (interpolation == "area") {
+      options.interpolation = ResizeInterpolation::Area;
+    } else if (interpolation != "bilinear") {
+      throw jsi::JSError(runtime, "Frame.resize(): Invalid interpolation \"" + interpolation + "\"!");
+    }
+  }
+
+  if (options.getSize() > kMaxTargetBytes) {
+    throw jsi::JSError(runtime, "Frame.resize(): The resized Frame would be " + std::to_string(options.getSize()) +
+                                    " bytes, which is more than the maximum of " + std::to_string(kMaxTargetBytes) + " bytes!");
+  }
+
+  options.mean = getChannelValues(runtime, object, "mean", 0.0f);
+  options.std = getChannelValues(runtime, object, "std", 1.0f);
+  for (float value : options.std) {
+    if (value == 0.0f) {
+      throw jsi::JSError(runtime, "Frame.resize(): `std` must not be 0!");
+    }
+  }
+
+  options.orientation = parseOrientationOptions(runtime, arguments, count, frameOrientation, "Frame.resize()");
+
+  return options;
+}
+
+namespace {
+
+  // A single 8-bit channel of the source image. Subsampled channels (YUV 4:2:0 chroma) have a `shift` of 1.
+  struct SourceChannel {
+    const uint8_t* data;
+    int32_t bytesPerRow;
+    int32_t pixelStride;
+    int32_t width;
+    int32_t height;
+    int32_t shift;
+  };
+
+  struct BilinearSample {
+    int32_t index0;
+    int32_t index1;
+    float weight;
+  };
+
+  struct AreaSample {
+    int32_t begin;
+    int32_t end;
+  };
+
+  // Pre-computed sample positions for one axis of one subsampling level, so the per-pixel loop only does table lookups.
+  struct AxisSamples {
+    std::vector<BilinearSample> bilinear;
+    std::vector<AreaSample> area;
+  };
+
+  AxisSamples createAxisSamples(ResizeInterpolation interpolation, int32_t cropOffset, int32_t cropSize, int32_t targetSize, int32_t shift,
+                                int32_t planeSize) {
+    AxisSamples samples;
+    float scale = static_cast<float>(cropSize) / static_cast<float>(targetSize);
+    float subsampling = static_cast<float>(1 << shift);
+
+    if (interpolation == ResizeInterpolation::Bilinear) {
+      samples.bilinear.resize(targetSize);
+      for (int32_t i = 0; i < targetSize; i++) {
+        // Pixel centers of the target, mapped into the plane
+        float position = (static_cast<float>(cropOffset) + (static_cast<float>(i) + 0.5f) * scale) / subsampling - 0.5f;
+        position = std::min(std::max(position, 0.0f), static_cast<float>(planeSize - 1));
+        int32_t index0 = static_cast<int32_t>(position);
+        BilinearSample& sample = samples.bilinear[i];
+        sample.index0 = index0;
+        sample.index1 = std::min(index0 + 1, planeSize - 1);
+        sample.weight = position - static_cast<float>(index0);
+      }
+    } else {
+      samples.area.resize(targetSize);
+      for (int32_t i = 0; i < targetSize; i++) {
+        // Source pixels covered by the target pixel, mapped into the plane
+        float begin = (static_cast<float>(cropOffset) + static_cast<float>(i) * scale) / subsampling;
+        float end = (static_cast<float>(cropOffset) + static_cast<float>(i + 1) * scale) / subsampling;
+        AreaSample& sample = samples.area[i];
+        sample.end = std::min(static_cast<int32_t>(std::ceil(end)), planeSize);
+        sample.begin = std::min(static_cast<int32_t>(std::floor(begin)), sample.end - 1);
+      }
+    }
+    return samples;
+  }
+
+  // BT.601 YUV -> RGB, with the same coefficients as `PixelConversion`.
+  struct FloatColorTransform {
+    float yOffset;
+    float yScale;
+    float rv;
+    float gu;
+    float gv;
+    float bu;
+  };
+
+  FloatColorTransform getFloatColorTransform(bool isFullRange) {
+    return isFullRange ? FloatColorTransform{0.0f, 1.0f, 1.402f, 0.344f, 0.714f, 1.772f}
+                       : FloatColorTransform{16.0f, 1.164f, 1.596f, 0.391f, 0.813f, 2.018f};
+  }
+
+  struct ResizeJob {
+    const ResizeOptions& options;
+    std::vector<SourceChannel> channels;
+    bool isYUV;
+    FloatColorTransform colorTransform;
+    // Sample tables per subsampling level (index = `SourceChannel::shift`)
+    std::vector<AxisSamples> columns;
+    std::vector<AxisSamples> rows;
+    uint8_t* destination;
+  };
+
+  inline float sampleBilinear(const SourceChannel& channel, const BilinearSample& column, const uint8_t* row0, const uint8_t* row1,
+                              float rowWeight) {
+    const int32_t x0 = column.index0 * channel.pixelStride;
+    const int32_t x1 = column.index1 * channel.pixelStride;
+    float top = row0[x0] + (row0[x1] - row0[x0]) * column.weight;
+    float bottom = row1[x0] + (row1[x1] - row1[x0]) * column.weight;
+    return top + (bottom - top) * rowWeight;
+  }
+
+  inline float sampleArea(const SourceChannel& channel, const AreaSample& column, const AreaSample& row) {
+    uint32_t sum = 0;
+    for (int32_t y = row.begin; y < row.end; y++) {
+      const uint8_t* line = channel.data + static_cast<size_t>(y) * channel.bytesPerRow;
+      for (int32_t x = column.begin; x < column.end; x++) {
+        sum += line[x * channel.pixelStride];
+      }
+    }
+    uint32_t count = static_cast<uint32_t>((row.end - row.begin) * (column.end - column.begin));
+    return static_cast<float>(sum) / static_cast<float>(count);
+  }
+
+  inline float clampChannel(float value) {
+    return std::min(std::max(value, 0.0f), 255.0f);
+  }
+
+  template <typename T> inline void storePixel(T* pixel, PixelLayout layout, T r, T g, T b, T alpha) {
+    switch (layout) {
+      case PixelLayout::RGB:
+        pixel[0] = r;
+        pixel[1] = g;
+        pixel[2] = b;
+        break;
+      case PixelLayout::BGR:
+        pixel[0] = b;
+        pixel[1] = g;
+        pixel[2] = r;
+        break;
+      case PixelLayout::RGBA:
+        pixel[0] = r;
+        pixel[1] = g;
+        pixel[2] = b;
+        pixel[3] = alpha;
+        break;
+      case PixelLayout::BGRA:
+        pixel[0] = b;
+        pixel[1] = g;
+        pixel[2] = r;
+        pixel[3] = alpha;
+        break;
+      case PixelLayout::Gray:
+        pixel[0] = r;
+        break;
+    }
+  }
+
+  template <ResizeInterpolation interpolation> void resizeRows(const ResizeJob& job, int32_t fromRow, int32_t toRow) {
+    const ResizeOptions& options = job.options;
+    const size_t bytesPerPixel = getBytesPerPixel(options.layout);
+    const bool isGray = options.layout == PixelLayout::Gray;
+    const bool isFloat = options.dataType == ResizeDataType::Float32;
+    // Gray from YUV is the luma channel, so the chroma planes don't need to be sampled at all.
+    const size_t channelsCount = job.isYUV && isGray ? 1 : job.channels.size();
+    const FloatColorTransform& transform = job.colorTransform;
+
+    for (int32_t y = fromRow; y < toRow; y++) {
+      // Resolve the source rows of every channel once per target row
+      const uint8_t* rows0[3];
+      const uint8_t* rows1[3];
+      float rowWeights[3];
+      for (size_t c = 0; c < channelsCount; c++) {
+        const SourceChannel& channel = job.channels[c];
+        if constexpr (interpolation == ResizeInterpolation::Bilinear) {
+          const BilinearSample& row = job.rows[channel.shift].bilinear[y];
+          rows0[c] = channel.data + static_cast<size_t>(row.index0) * channel.bytesPerRow;
+          rows1[c] = channel.data + static_cast<size_t>(row.index1) * channel.bytesPerRow;
+          rowWeights[c] = row.weight;
+        }
+      }
+
+      uint8_t* destinationRow = job.destination + static_cast<size_t>(y) * options.width * bytesPerPixel * (isFloat ? sizeof(float) : 1);
+
+      for (int32_t x = 0; x < options.width; x++) {
+        float values[3];
+        for (size_t c = 0; c < channelsCount; c++) {
+          const SourceChannel& channel = job.channels[c];
+          if constexpr (interpolation == ResizeInterpolation::Bilinear) {
+            values[c] = sampleBilinear(channel, job.columns[channel.shift].bilinear[x], rows0[c], rows1[c], rowWeights[c]);
+          } else {
+            values[c] = sampleArea(channel, job.columns[channel.shift].area[x], job.rows[channel.shift].area[y]);
+          }
+        }
+
+        float r, g, b;
+        if (job.isYUV) {
+          if (isGray) {
+            r = g = b = values[0];
+          } else {
+            float yy = (values[0] - transform.yOffset) * transform.yScale;
+            float d = values[1] - 128.0f;
+            float e = values[2] - 128.0f;
+            r = clampChannel(yy + transform.rv * e);
+            g = clampChannel(yy - transform.gu * d - transform.gv * e);
+            b = clampChannel(yy + transform.bu * d);
+          }
+        } else {
+          r = values[0];
+          g = values[1];
+          b = values[2];
+        }
+        if (isGray && !job.isYUV) {
+          r = 0.299f * r + 0.587f * g + 0.114f * b;
+        }
+
+        if (isFloat) {
+          float* pixel = reinterpret_cast<float*>(destinationRow) + x * bytesPerPixel;
+          float normalizedR = (r / 255.0f - options.mean[0]) / options.std[0];
+          float normalizedG = (g / 255.0f - options.mean[1]) / options.std[1];
+          float normalizedB = (b / 255.0f - options.mean[2]) / options.std[2];
+          storePixel<float>(pixel, options.layout, normalizedR, normalizedG, normalizedB, 1.0f);
+        } else {
+          uint8_t* pixel = destinationRow + x * bytesPerPixel;
+          storePixel<uint8_t>(pixel, options.layout, static_cast<uint8_t>(r + 0.5f), static_cast<uint8_t>(g + 0.5f),
+                              static_cast<uint8_t>(b + 0.5f), 255);
+        }
+      }
+    }
+  }
+
+} // namespace
+
+std::shared_ptr<MutableRawBuffer> resizeFramePlanes(const std::vector<FramePlane>& planes, PixelLayout packedLayout, bool isFullRange,
+                                                    const ResizeOptions& options) {
+  if (planes.empty()) {
+    throw std::runtime_error("Cannot resize a Frame without any planes!");
+  }
+  const FramePlane& firstPlane = planes[0];
+
+  std::vector<SourceChannel> channels;
+  bool isYUV;
+  if (planes.size() == 1 && firstPlane.pixelStride == 4) {
+    // Packed RGBA/BGRA, sampled as three interleaved channels in R, G, B order
+    isYUV = false;
+    int32_t rOffset = packedLayout == PixelLayout::BGRA ? 2 : 0;
+    int32_t bOffset = packedLayout == PixelLayout::BGRA ? 0 : 2;
+    for (int32_t offset : {rOffset, 1, bOffset}) {
+      channels.push_back({firstPlane.data + offset, firstPlane.bytesPerRow, 4, firstPlane.width, firstPlane.height, 0});
+    }
+  } else if ((planes.size() == 2 || planes.size() == 3) && firstPlane.pixelStride == 1) {
+    // YUV 4:2:0, either planar/semi-planar in 3 planes (Android), or Y + interleaved CbCr in 2 planes (iOS)
+    isYUV = true;
+    const FramePlane& uPlane = planes[1];
+    const uint8_t* v = planes.size() == 3 ? planes[2].data : uPlane.data + 1;
+    int32_t chromaWidth = (firstPlane.width + 1) / 2;
+    int32_t chromaHeight = (firstPlane.height + 1) / 2;
+    channels.push_back({firstPlane.data, firstPlane.bytesPerRow, 1, firstPlane.width, firstPlane.height, 0});
+    channels.push_back({uPlane.data, uPlane.bytesPerRow, uPlane.pixelStride, chromaWidth, chromaHeight, 1});
+    channels.push_back({v, uPlane.bytesPerRow, uPlane.pixelStride, chromaWidth, chromaHeight, 1});
+  } else {
+    throw std::runtime_error("Cannot resize a Frame with " + std::to_string(planes.size()) + " planes and a pixel stride of " +
+                             std::to_string(firstPlane.pixelStride) + " - only 8-bit YUV 4:2:0 and RGB Frames can be resized!");
+  }
+
+  // Rotations by 90° and 270° swap the axes, so the Frame is resized to the transposed size first.
+  ResizeOptions samplingOptions = options;
+  if (options.orientation.isTransposed()) {
+    std::swap(samplingOptions.width, samplingOptions.height);
+  }
+
+  auto buffer = ArrayBufferPool::getSharedInstance()->acquire(samplingOptions.getSize());
+
+  ResizeJob job{samplingOptions, channels, isYUV, getFloatColorTransform(isFullRange), {}, {}, buffer->data()};
+  int32_t levels = isYUV ? 2 : 1;
+  for (int32_t shift = 0; shift < levels; shift++) {
+    const SourceChannel& channel = channels[shift];
+    job.columns.push_back(createAxisSamples(samplingOptions.interpolation, samplingOptions.cropX, samplingOptions.cropWidth,
+                                            samplingOptions.width, shift, channel.width));
+    job.rows.push_back(createAxisSamples(samplingOptions.interpolation, samplingOptions.cropY, samplingOptions.cropHeight,
+                                         samplingOptions.height, shift, channel.height));
+  }
+
+  // Bands of target rows are small enough that their source rows stay in cache, and are distributed across all cores.
+  constexpr size_t kRowsPerBand = 16;
+  ThreadPool::getSharedInstance()->parallelFor(samplingOptions.height, kRowsPerBand, [&](size_t begin, size_t end) {
+    if (samplingOptions.interpolation == ResizeInterpolation::Bilinear) {
+      resizeRows<ResizeInterpolation::Bilinear>(job, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+    } else {
+      resizeRows<ResizeInterpolation::Area>(job, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+    }
+  });
+
+  if (options.orientation.isIdentity()) {
+    return buffer;
+  }
+  size_t bytesPerPixel = options.getSize() / (static_cast<size_t>(options.width) * options.height);
+  return ImageRotation::rotateToPooledBuffer(buffer->data(), samplingOptions.width, samplingOptions.height,
+                                             samplingOptions.width * bytesPerPixel, bytesPerPixel, options.orientation);
+}
+
+} // namespace vision
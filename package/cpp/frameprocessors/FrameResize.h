@@ -0,0 +1,86 @@
+//
+//  FrameResize.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "FrameMetadata.h"
+#include "FramePlane.h"
+#include "ImageRotation.h"
+#include "MutableRawBuffer.h"
+#include "PixelConversion.h"
+#include <jsi/jsi.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+enum class ResizeInterpolation {
+  // Bilinear sampling, best for up-scaling and mild down-scaling
+  Bilinear,
+  // Averages all source pixels covered by a target pixel, best for strong down-scaling
+  Area,
+};
+
+enum class ResizeDataType {
+  // One byte per channel in [0...255]
+  Uint8,
+  // One float per channel, `(value / 255 - mean) / std`
+  Float32,
+};
+
+/**
+ * The options of `Frame.resize(..)`.
+ */
+struct ResizeOptions {
+  // Target size, after applying `orientation`
+  int32_t width;
+  int32_t height;
+  // Source rectangle in Frame pixels
+  int32_t cropX;
+  int32_t cropY;
+  int32_t cropWidth;
+  int32_t cropHeight;
+  PixelLayout layout;
+  ResizeDataType dataType;
+  ResizeInterpolation interpolation;
+  // Per channel (R, G, B) normalization for Float32, Gray uses the first value
+  std::array<float, 3> mean;
+  std::array<float, 3> std;
+  OrientationOptions orientation;
+
+  /**
+   * The size of the resulting buffer in bytes.
+   */
+  size_t getSize() const;
+};
+
+/**
+ * Parses the options object passed to `Frame.resize(..)`, and validates it against the size of the Frame.
+ * Throws a `jsi::JSError` if the options are invalid.
+ */
+ResizeOptions parseResizeOptions(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count, int32_t frameWidth, int32_t frameHeight,
+                                 FrameOrientation frameOrientation);
+
+/**
+ * Crops, resizes, converts and normalizes the planes of an 8-bit YUV 4:2:0 or a packed 4-channel Frame in one pass
+ * into a pooled buffer. The rows of the target are processed in cache-sized bands on the shared `ThreadPool`.
+ * If the options contain a rotation or mirroring, the (small) resized image is rotated afterwards.
+ *
+ * `packedLayout` is the channel order of packed Frames (`RGBA` or `BGRA`), and `isFullRange` the range of YUV Frames.
+ * Throws a `std::runtime_error` if the plane configuration is not supported.
+ */
+std::shared_ptr<MutableRawBuffer> resizeFramePlanes(const std::vector<FramePlane>& planes, PixelLayout packedLayout, bool isFullRange,
+                                                    const ResizeOptions& options);
+
+} // namespace vision
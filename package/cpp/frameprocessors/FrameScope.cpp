@@ -0,0 +1,121 @@
+//
+//  FrameScope.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameScope.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace vision {
+
+namespace {
+
+  struct MemoryCounters {
+    std::atomic<uint64_t> frames{0};
+    std::atomic<uint64_t> arenaPeakBytes{0};
+    std::atomic<uint64_t> arenaReservedBytes{0};
+    std::atomic<uint64_t> heapGrowthPeakBytes{0};
+    std::atomic<uint64_t> heapGrowthTotalBytes{0};
+    std::atomic<uint64_t> heapGrowthSamples{0};
+  };
+
+  MemoryCounters& getCounters() {
+    // Leaked on purpose, Frames might still arrive while static destructors run.
+    static MemoryCounters* counters = new MemoryCounters();
+    return *counters;
+  }
+
+  FrameArena& getThreadArena() {
+    static thread_local FrameArena arena;
+    return arena;
+  }
+
+  void updateMax(std::atomic<uint64_t>& max, uint64_t value) {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (value > current && !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+  }
+
+  // Reading the heap size walks the heap's segments (Hermes), so it is only sampled on every n-th Frame.
+  constexpr uint32_t kHeapSampleInterval = 16;
+
+  /**
+   * Whether this Thread's next Frame should sample the heap size.
+   */
+  bool shouldSampleHeapSize() noexcept {
+    static thread_local uint32_t frameIndex = 0;
+    return frameIndex++ % kHeapSampleInterval == 0;
+  }
+
+  /**
+   * Get the number of bytes currently allocated in the JS heap, or -1 if the runtime does not report it.
+   */
+  int64_t getHeapSize(jsi::Runtime& runtime) noexcept {
+    try {
+      auto heapInfo = runtime.instrumentation().getHeapInfo(false);
+      auto allocatedBytes = heapInfo.find("hermes_allocatedBytes");
+      return allocatedBytes != heapInfo.end() ? allocatedBytes->second : -1;
+    } catch (...) {
+      return -1;
+    }
+  }
+
+} // namespace
+
+FrameScope::FrameScope(jsi::Runtime& runtime)
+    : _runtime(runtime), _scope(runtime), _previousArena(FrameArena::getCurrent()), _heapSizeBefore(-1) {
+  if (_previousArena == nullptr && shouldSampleHeapSize()) {
+    _heapSizeBefore = getHeapSize(runtime);
+  }
+  FrameArena::setCurrent(&getThreadArena());
+}
+
+FrameScope::~FrameScope() {
+  FrameArena* arena = FrameArena::getCurrent();
+  FrameArena::setCurrent(_previousArena);
+  if (_previousArena != nullptr) {
+    // Nested scope, the outer scope resets the arena once the Frame is done.
+    return;
+  }
+
+  MemoryCounters& counters = getCounters();
+  counters.frames.fetch_add(1, std::memory_order_relaxed);
+  updateMax(counters.arenaPeakBytes, arena->getBytesUsed());
+  counters.arenaReservedBytes.store(arena->getBytesReserved(), std::memory_order_relaxed);
+  arena->reset();
+
+  int64_t heapSizeAfter = _heapSizeBefore >= 0 ? getHeapSize(_runtime) : -1;
+  if (heapSizeAfter >= 0) {
+    // If the GC ran during this Frame, the heap might have shrunk.
+    uint64_t growth = heapSizeAfter > _heapSizeBefore ? static_cast<uint64_t>(heapSizeAfter - _heapSizeBefore) : 0;
+    updateMax(counters.heapGrowthPeakBytes, growth);
+    counters.heapGrowthTotalBytes.fetch_add(growth, std::memory_order_relaxed);
+    counters.heapGrowthSamples.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+FrameScope::Stats FrameScope::getStats(bool reset) {
+  MemoryCounters& counters = getCounters();
+  auto read = [reset](std::atomic<uint64_t>& counter) {
+    return reset ? counter.exchange(0, std::memory_order_relaxed) : counter.load(std::memory_order_relaxed);
+  };
+
+  Stats stats;
+  stats.frames = counters.frames.load(std::memory_order_relaxed);
+  stats.arenaPeakBytes = read(counters.arenaPeakBytes);
+  stats.arenaReservedBytes = counters.arenaReservedBytes.load(std::memory_order_relaxed);
+  stats.heapGrowthPeakBytes = read(counters.heapGrowthPeakBytes);
+  uint64_t heapGrowthTotal = read(counters.heapGrowthTotalBytes);
+  uint64_t heapGrowthSamples = read(counters.heapGrowthSamples);
+  stats.heapGrowthMeanBytes = heapGrowthSamples > 0 ? static_cast<double>(heapGrowthTotal) / static_cast<double>(heapGrowthSamples) : 0;
+  return stats;
+}
+
+} // namespace vision
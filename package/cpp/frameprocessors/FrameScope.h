@@ -0,0 +1,58 @@
+//
+//  FrameScope.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "FrameArena.h"
+#include <jsi/jsi.h>
+
+#include <cstdint>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * Wraps a single Frame Processor call.
+ *
+ * - Opens a `jsi::Scope`, so all JS values allocated for this Frame can be picked up by the GC right after.
+ * - Makes this Thread's `FrameArena` available through `FrameArena::getCurrent()`, and resets it once the Frame is done.
+ * - Records the peak arena usage, and how much the JS heap grew on every 16th Frame.
+ */
+class FrameScope {
+public:
+  struct Stats {
+    uint64_t frames = 0;
+    // The most arena memory a single Frame used, and the memory the arena holds on to
+    uint64_t arenaPeakBytes = 0;
+    uint64_t arenaReservedBytes = 0;
+    // How much the JS heap grew during a single sampled Frame, if the runtime reports its heap size (Hermes)
+    uint64_t heapGrowthPeakBytes = 0;
+    double heapGrowthMeanBytes = 0;
+  };
+
+public:
+  explicit FrameScope(jsi::Runtime& runtime);
+  ~FrameScope();
+
+  FrameScope(const FrameScope&) = delete;
+  FrameScope& operator=(const FrameScope&) = delete;
+
+  /**
+   * Get the memory stats of all Frames so far. If `reset` is true, the peaks and means start over.
+   */
+  static Stats getStats(bool reset = false);
+
+private:
+  jsi::Runtime& _runtime;
+  jsi::Scope _scope;
+  FrameArena* _previousArena;
+  int64_t _heapSizeBefore;
+};
+
+} // namespace vision
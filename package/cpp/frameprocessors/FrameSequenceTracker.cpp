@@ -0,0 +1,87 @@
+//
+//  FrameSequenceTracker.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameSequenceTracker.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+
+namespace vision {
+
+// Longer gaps mean the Camera was paused or restarted, which is not a Frame drop.
+static constexpr int64_t kMaxFrameIntervalNs = 1'000'000'000;
+// An interval of at least 1.5x the expected interval means at least one Frame is missing.
+static constexpr double kDropThreshold = 1.5;
+// How fast the expected interval follows frame rate changes
+static constexpr double kIntervalSmoothing = 1.0 / 8.0;
+
+namespace {
+
+  struct Counters {
+    std::atomic<uint64_t> processed{0};
+    std::atomic<uint64_t> dropped{0};
+    LatencyHistogram queueingDelay;
+  };
+
+  Counters& getCounters() {
+    // Leaked on purpose, Frames might still arrive while static destructors run.
+    static Counters* counters = new Counters();
+    return *counters;
+  }
+
+} // namespace
+
+void FrameSequenceTracker::onFrame(int64_t timestampNs, int64_t queueingDelayNs, int64_t maxFrameDurationNs) {
+  Counters& counters = getCounters();
+  counters.processed.fetch_add(1, std::memory_order_relaxed);
+  if (queueingDelayNs >= 0) {
+    counters.queueingDelay.record(static_cast<uint64_t>(queueingDelayNs / 1000));
+  }
+
+  int64_t intervalNs = timestampNs - _lastTimestampNs;
+  bool isSameSequence = _lastTimestampNs != 0 && intervalNs > 0 && intervalNs <= kMaxFrameIntervalNs;
+  _lastTimestampNs = timestampNs;
+  if (!isSameSequence) {
+    // First Frame, or the Camera restarted - start a new sequence.
+    _expectedIntervalNs = 0;
+    return;
+  }
+
+  double interval = static_cast<double>(intervalNs);
+  // The Camera never delivers Frames slower than its configured maximum Frame duration, longer intervals contain drops.
+  double maxExpectedIntervalNs = static_cast<double>(maxFrameDurationNs > 0 ? maxFrameDurationNs : kMaxFrameIntervalNs);
+  if (_expectedIntervalNs == 0 || interval * kDropThreshold < _expectedIntervalNs) {
+    // The first interval of a sequence, or the frame rate went up a lot (the previous estimate might have contained drops)
+    _expectedIntervalNs = std::min(interval, maxExpectedIntervalNs);
+  }
+
+  double framesCount = interval / _expectedIntervalNs;
+  if (framesCount >= kDropThreshold) {
+    // There is a gap - every missing interval is one dropped Frame.
+    auto missingFrames = static_cast<uint64_t>(std::llround(framesCount)) - 1;
+    counters.dropped.fetch_add(missingFrames, std::memory_order_relaxed);
+  } else {
+    _expectedIntervalNs += (interval - _expectedIntervalNs) * kIntervalSmoothing;
+    _expectedIntervalNs = std::min(_expectedIntervalNs, maxExpectedIntervalNs);
+  }
+}
+
+FrameSequenceTracker::Stats FrameSequenceTracker::getStats() {
+  Counters& counters = getCounters();
+  Stats stats;
+  stats.processed = counters.processed.load(std::memory_order_relaxed);
+  stats.dropped = counters.dropped.load(std::memory_order_relaxed);
+  return stats;
+}
+
+LatencyHistogram& FrameSequenceTracker::getQueueingDelayHistogram() {
+  return getCounters().queueingDelay;
+}
+
+} // namespace vision
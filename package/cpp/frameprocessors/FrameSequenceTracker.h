@@ -0,0 +1,70 @@
+//
+//  FrameSequenceTracker.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "LatencyHistogram.h"
+
+#include <cstdint>
+
+namespace vision {
+
+/**
+ * Detects Frames that never reached the Frame Processor, from gaps in the sensor timestamps of the Frames that did.
+ *
+ * When the Frame Processor is slower than the Camera, Frames are dropped upstream (CameraX's backpressure strategy,
+ * or `alwaysDiscardsLateVideoFrames` on iOS) without VisionCamera ever seeing them. The expected Frame interval is
+ * tracked per sequence, so gradual frame rate changes (e.g. auto-exposure in low light) are not counted as drops.
+ * It never exceeds the Camera's configured maximum Frame duration, so a steady 1-in-N delivery, or a first interval
+ * that already contains a drop, is still counted. Gaps longer than a second (e.g. the Camera restarted) start a new
+ * sequence instead.
+ *
+ * Every Frame Processor owns its own tracker, so Frames of two Cameras (or of a replaced Frame Processor) are never
+ * mistaken for one sequence. Only the counters and the queueing delay are aggregated across all trackers.
+ */
+class FrameSequenceTracker {
+public:
+  struct Stats {
+    // Number of Frames that reached the Frame Processor
+    uint64_t processed = 0;
+    // Number of Frames that were dropped before they reached the Frame Processor
+    uint64_t dropped = 0;
+  };
+
+public:
+  FrameSequenceTracker() = default;
+
+  FrameSequenceTracker(const FrameSequenceTracker&) = delete;
+  FrameSequenceTracker& operator=(const FrameSequenceTracker&) = delete;
+
+public:
+  /**
+   * Tracks a Frame right before it is passed to the Frame Processor. Must always be called from the same Thread.
+   * @param timestampNs The sensor timestamp of the Frame, in nanoseconds.
+   * @param queueingDelayNs The time between the sensor timestamp and now in nanoseconds, or a negative value if unknown.
+   * @param maxFrameDurationNs The longest Frame interval the Camera is configured for (1 / min FPS) in nanoseconds,
+   *                           or 0 if unknown.
+   */
+  void onFrame(int64_t timestampNs, int64_t queueingDelayNs, int64_t maxFrameDurationNs);
+
+  /**
+   * The Frame counts of all trackers.
+   */
+  static Stats getStats();
+  /**
+   * The time between a Frame's sensor timestamp and the start of the Frame Processor, of all trackers.
+   */
+  static LatencyHistogram& getQueueingDelayHistogram();
+
+private:
+  // Only accessed from the Frame Processor Thread
+  int64_t _lastTimestampNs = 0;
+  double _expectedIntervalNs = 0;
+};
+
+} // namespace vision
@@ -0,0 +1,353 @@
+//
+//  ImageRotation.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ImageRotation.h"
+#include "ArrayBufferPool.h"
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define VISION_IMAGE_ROTATION_NEON 1
+#include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define VISION_IMAGE_ROTATION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace vision {
+
+using namespace facebook;
+
+RotationAngle getUprightRotation(FrameOrientation orientation) {
+  switch (orientation) {
+    case FrameOrientation::Portrait:
+      return RotationAngle::Degrees0;
+    case FrameOrientation::LandscapeLeft:
+      return RotationAngle::Degrees270;
+    case FrameOrientation::PortraitUpsideDown:
+      return RotationAngle::Degrees180;
+    case FrameOrientation::LandscapeRight:
+      return RotationAngle::Degrees90;
+  }
+  return RotationAngle::Degrees0;
+}
+
+OrientationOptions parseOrientationOptions(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count, FrameOrientation orientation,
+                                           const char* methodName) {
+  OrientationOptions result;
+  result.rotation = RotationAngle::Degrees0;
+  result.mirror = false;
+  if (count < 1 || !arguments[0].isObject()) {
+    return result;
+  }
+  jsi::Object object = arguments[0].getObject(runtime);
+
+  jsi::Value orientationValue = object.getProperty(runtime, "orientation");
+  if (orientationValue.isString()) {
+    std::string value = orientationValue.getString(runtime).utf8(runtime);
+    if (value == "upright") {
+      result.rotation = getUprightRotation(orientation);
+    } else if (value != "original") {
+      throw jsi::JSError(runtime, std::string(methodName) + ": Invalid orientation \"" + value + "\"!");
+    }
+  }
+
+  jsi::Value mirrorValue = object.getProperty(runtime, "mirror");
+  if (mirrorValue.isBool()) {
+    result.mirror = mirrorValue.getBool();
+  }
+  return result;
+}
+
+namespace ImageRotation {
+
+  namespace {
+
+    // The destination of source pixel (x, y) is `destination + base + x * stepX + y * stepY`.
+    struct PixelMapping {
+      ptrdiff_t base;
+      ptrdiff_t stepX;
+      ptrdiff_t stepY;
+      // Whether source columns become destination rows (90° and 270°)
+      bool isTransposed;
+    };
+
+    PixelMapping createPixelMapping(int32_t width, int32_t height, size_t destinationBytesPerRow, size_t bytesPerPixel,
+                                    const OrientationOptions& options) {
+      // destination x = ax * x + ay * y + a0, destination y = bx * x + by * y + b0
+      ptrdiff_t ax, ay, a0, bx, by, b0;
+      switch (options.rotation) {
+        case RotationAngle::Degrees0:
+          ax = 1, ay = 0, a0 = 0, bx = 0, by = 1, b0 = 0;
+          break;
+        case RotationAngle::Degrees90:
+          ax = 0, ay = -1, a0 = height - 1, bx = 1, by = 0, b0 = 0;
+          break;
+        case RotationAngle::Degrees180:
+          ax = -1, ay = 0, a0 = width - 1, bx = 0, by = -1, b0 = height - 1;
+          break;
+        case RotationAngle::Degrees270:
+          ax = 0, ay = 1, a0 = 0, bx = -1, by = 0, b0 = width - 1;
+          break;
+      }
+      if (options.mirror) {
+        ptrdiff_t destinationWidth = options.isTransposed() ? height : width;
+        ax = -ax, ay = -ay, a0 = destinationWidth - 1 - a0;
+      }
+
+      PixelMapping mapping;
+      ptrdiff_t pixelSize = static_cast<ptrdiff_t>(bytesPerPixel);
+      ptrdiff_t rowSize = static_cast<ptrdiff_t>(destinationBytesPerRow);
+      mapping.base = b0 * rowSize + a0 * pixelSize;
+      mapping.stepX = bx * rowSize + ax * pixelSize;
+      mapping.stepY = by * rowSize + ay * pixelSize;
+      mapping.isTransposed = ax == 0;
+      return mapping;
+    }
+
+    struct RotationJob {
+      const uint8_t* source;
+      int32_t width;
+      int32_t height;
+      size_t sourceBytesPerRow;
+      uint8_t* destination;
+      size_t bytesPerPixel;
+      PixelMapping mapping;
+    };
+
+    template <size_t kBytesPerPixel> inline void copyPixel(uint8_t* destination, const uint8_t* source, size_t bytesPerPixel) {
+      if constexpr (kBytesPerPixel == 0) {
+        memcpy(destination, source, bytesPerPixel);
+      } else {
+        memcpy(destination, source, kBytesPerPixel);
+      }
+    }
+
+    // Scalar fallback for the pixels of a tile that are not covered by a SIMD block.
+    template <size_t kBytesPerPixel>
+    void transposeRect(const RotationJob& job, int32_t fromX, int32_t toX, int32_t fromY, int32_t toY) {
+      const PixelMapping& mapping = job.mapping;
+      for (int32_t y = fromY; y < toY; y++) {
+        const uint8_t* sourceRow = job.source + static_cast<size_t>(y) * job.sourceBytesPerRow;
+        uint8_t* destination = job.destination + mapping.base + y * mapping.stepY;
+        for (int32_t x = fromX; x < toX; x++) {
+          copyPixel<kBytesPerPixel>(destination + x * mapping.stepX, sourceRow + x * job.bytesPerPixel, job.bytesPerPixel);
+        }
+      }
+    }
+
+    // Transposes the 8x8 block of 1 byte pixels at (x, y).
+    inline void transposeBlock8x8(const RotationJob& job, int32_t x, int32_t y) {
+      const PixelMapping& mapping = job.mapping;
+      // Destination rows are written in ascending address order, so if they run against the source rows, read those bottom-up.
+      bool isReversed = mapping.stepY < 0;
+      const uint8_t* rows[8];
+      for (int32_t i = 0; i < 8; i++) {
+        int32_t row = y + (isReversed ? 7 - i : i);
+        rows[i] = job.source + static_cast<size_t>(row) * job.sourceBytesPerRow + x;
+      }
+      uint8_t* destination = job.destination + mapping.base + x * mapping.stepX + (isReversed ? y + 7 : y) * mapping.stepY;
+
+#if VISION_IMAGE_ROTATION_NEON
+      uint8x8x2_t t01 = vtrn_u8(vld1_u8(rows[0]), vld1_u8(rows[1]));
+      uint8x8x2_t t23 = vtrn_u8(vld1_u8(rows[2]), vld1_u8(rows[3]));
+      uint8x8x2_t t45 = vtrn_u8(vld1_u8(rows[4]), vld1_u8(rows[5]));
+      uint8x8x2_t t67 = vtrn_u8(vld1_u8(rows[6]), vld1_u8(rows[7]));
+      uint16x4x2_t u02 = vtrn_u16(vreinterpret_u16_u8(t01.val[0]), vreinterpret_u16_u8(t23.val[0]));
+      uint16x4x2_t u13 = vtrn_u16(vreinterpret_u16_u8(t01.val[1]), vreinterpret_u16_u8(t23.val[1]));
+      uint16x4x2_t u46 = vtrn_u16(vreinterpret_u16_u8(t45.val[0]), vreinterpret_u16_u8(t67.val[0]));
+      uint16x4x2_t u57 = vtrn_u16(vreinterpret_u16_u8(t45.val[1]), vreinterpret_u16_u8(t67.val[1]));
+      uint32x2x2_t v04 = vtrn_u32(vreinterpret_u32_u16(u02.val[0]), vreinterpret_u32_u16(u46.val[0]));
+      uint32x2x2_t v26 = vtrn_u32(vreinterpret_u32_u16(u02.val[1]), vreinterpret_u32_u16(u46.val[1]));
+      uint32x2x2_t v15 = vtrn_u32(vreinterpret_u32_u16(u13.val[0]), vreinterpret_u32_u16(u57.val[0]));
+      uint32x2x2_t v37 = vtrn_u32(vreinterpret_u32_u16(u13.val[1]), vreinterpret_u32_u16(u57.val[1]));
+      vst1_u8(destination + 0 * mapping.stepX, vreinterpret_u8_u32(v04.val[0]));
+      vst1_u8(destination + 1 * mapping.stepX, vreinterpret_u8_u32(v15.val[0]));
+      vst1_u8(destination + 2 * mapping.stepX, vreinterpret_u8_u32(v26.val[0]));
+      vst1_u8(destination + 3 * mapping.stepX, vreinterpret_u8_u32(v37.val[0]));
+      vst1_u8(destination + 4 * mapping.stepX, vreinterpret_u8_u32(v04.val[1]));
+      vst1_u8(destination + 5 * mapping.stepX, vreinterpret_u8_u32(v15.val[1]));
+      vst1_u8(destination + 6 * mapping.stepX, vreinterpret_u8_u32(v26.val[1]));
+      vst1_u8(destination + 7 * mapping.stepX, vreinterpret_u8_u32(v37.val[1]));
+#elif VISION_IMAGE_ROTATION_SSE2
+      auto load = [&](int32_t i) { return _mm_loadl_epi64(reinterpret_cast<const __m128i*>(rows[i])); };
+      __m128i a0 = _mm_unpacklo_epi8(load(0), load(1));
+      __m128i a1 = _mm_unpacklo_epi8(load(2), load(3));
+      __m128i a2 = _mm_unpacklo_epi8(load(4), load(5));
+      __m128i a3 = _mm_unpacklo_epi8(load(6), load(7));
+      __m128i b0 = _mm_unpacklo_epi16(a0, a1);
+      __m128i b1 = _mm_unpackhi_epi16(a0, a1);
+      __m128i b2 = _mm_unpacklo_epi16(a2, a3);
+      __m128i b3 = _mm_unpackhi_epi16(a2, a3);
+      // Every register holds two transposed rows
+      __m128i columns[4] = {_mm_unpacklo_epi32(b0, b2), _mm_unpackhi_epi32(b0, b2), _mm_unpacklo_epi32(b1, b3), _mm_unpackhi_epi32(b1, b3)};
+      for (int32_t i = 0; i < 4; i++) {
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(destination + (2 * i) * mapping.stepX), columns[i]);
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(destination + (2 * i + 1) * mapping.stepX), _mm_srli_si128(columns[i], 8));
+      }
+#else
+      for (int32_t i = 0; i < 8; i++) {
+        for (int32_t j = 0; j < 8; j++) {
+          destination[i * mapping.stepX + j] = rows[j][i];
+        }
+      }
+#endif
+    }
+
+    // Transposes the 4x4 block of 4 byte pixels at (x, y).
+    inline void transposeBlock4x4(const RotationJob& job, int32_t x, int32_t y) {
+      const PixelMapping& mapping = job.mapping;
+      bool isReversed = mapping.stepY < 0;
+      const uint8_t* rows[4];
+      for (int32_t i = 0; i < 4; i++) {
+        int32_t row = y + (isReversed ? 3 - i : i);
+        rows[i] = job.source + static_cast<size_t>(row) * job.sourceBytesPerRow + static_cast<size_t>(x) * 4;
+      }
+      uint8_t* destination = job.destination + mapping.base + x * mapping.stepX + (isReversed ? y + 3 : y) * mapping.stepY;
+
+#if VISION_IMAGE_ROTATION_NEON
+      uint32x4x2_t t01 = vtrnq_u32(vreinterpretq_u32_u8(vld1q_u8(rows[0])), vreinterpretq_u32_u8(vld1q_u8(rows[1])));
+      uint32x4x2_t t23 = vtrnq_u32(vreinterpretq_u32_u8(vld1q_u8(rows[2])), vreinterpretq_u32_u8(vld1q_u8(rows[3])));
+      // vtrnq_u32 interleaves pairs of columns, the low/high halves then hold columns 0/1 and 2/3
+      uint32x4_t columns[4] = {vcombine_u32(vget_low_u32(t01.val[0]), vget_low_u32(t23.val[0])),
+                               vcombine_u32(vget_low_u32(t01.val[1]), vget_low_u32(t23.val[1])),
+                               vcombine_u32(vget_high_u32(t01.val[0]), vget_high_u32(t23.val[0])),
+                               vcombine_u32(vget_high_u32(t01.val[1]), vget_high_u32(t23.val[1]))};
+      for (int32_t i = 0; i < 4; i++) {
+        vst1q_u8(destination + i * mapping.stepX, vreinterpretq_u8_u32(columns[i]));
+      }
+#elif VISION_IMAGE_ROTATION_SSE2
+      auto load = [&](int32_t i) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(rows[i])); };
+      __m128i r0 = load(0), r1 = load(1), r2 = load(2), r3 = load(3);
+      __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+      __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+      __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+      __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 0 * mapping.stepX), _mm_unpacklo_epi64(t0, t1));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 1 * mapping.stepX), _mm_unpackhi_epi64(t0, t1));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 2 * mapping.stepX), _mm_unpacklo_epi64(t2, t3));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 3 * mapping.stepX), _mm_unpackhi_epi64(t2, t3));
+#else
+      for (int32_t i = 0; i < 4; i++) {
+        for (int32_t j = 0; j < 4; j++) {
+          memcpy(destination + i * mapping.stepX + j * 4, rows[j] + i * 4, 4);
+        }
+      }
+#endif
+    }
+
+    // Side length of the square source tiles, so that a tile's source and destination rows both stay in L1.
+    constexpr int32_t kTileSize = 32;
+
+    template <size_t kBytesPerPixel> void transposeTile(const RotationJob& job, int32_t fromX, int32_t fromY) {
+      int32_t toX = std::min(fromX + kTileSize, job.width);
+      int32_t toY = std::min(fromY + kTileSize, job.height);
+
+      constexpr int32_t blockSize = kBytesPerPixel == 1 ? 8 : kBytesPerPixel == 4 ? 4 : 0;
+      if constexpr (blockSize > 0) {
+        int32_t blocksEndX = fromX + (toX - fromX) / blockSize * blockSize;
+        int32_t blocksEndY = fromY + (toY - fromY) / blockSize * blockSize;
+        for (int32_t y = fromY; y < blocksEndY; y += blockSize) {
+          for (int32_t x = fromX; x < blocksEndX; x += blockSize) {
+            if constexpr (kBytesPerPixel == 1) {
+              transposeBlock8x8(job, x, y);
+            } else {
+              transposeBlock4x4(job, x, y);
+            }
+          }
+        }
+        // Right and bottom edges of the tile
+        transposeRect<kBytesPerPixel>(job, blocksEndX, toX, fromY, blocksEndY);
+        transposeRect<kBytesPerPixel>(job, fromX, toX, blocksEndY, toY);
+      } else {
+        transposeRect<kBytesPerPixel>(job, fromX, toX, fromY, toY);
+      }
+    }
+
+    template <size_t kBytesPerPixel> void transposeTileRows(const RotationJob& job, int32_t fromTileRow, int32_t toTileRow) {
+      for (int32_t tileRow = fromTileRow; tileRow < toTileRow; tileRow++) {
+        for (int32_t x = 0; x < job.width; x += kTileSize) {
+          transposeTile<kBytesPerPixel>(job, x, tileRow * kTileSize);
+        }
+      }
+    }
+
+    // 0° and 180° keep rows intact, so they are copied row by row (and reversed if needed).
+    template <size_t kBytesPerPixel> void copyRows(const RotationJob& job, int32_t fromRow, int32_t toRow) {
+      const PixelMapping& mapping = job.mapping;
+      size_t rowSize = static_cast<size_t>(job.width) * job.bytesPerPixel;
+      for (int32_t y = fromRow; y < toRow; y++) {
+        const uint8_t* sourceRow = job.source + static_cast<size_t>(y) * job.sourceBytesPerRow;
+        uint8_t* destination = job.destination + mapping.base + y * mapping.stepY;
+        if (mapping.stepX > 0) {
+          memcpy(destination, sourceRow, rowSize);
+        } else {
+          for (int32_t x = 0; x < job.width; x++) {
+            copyPixel<kBytesPerPixel>(destination + x * mapping.stepX, sourceRow + x * job.bytesPerPixel, job.bytesPerPixel);
+          }
+        }
+      }
+    }
+
+    template <size_t kBytesPerPixel> void rotate(const RotationJob& job) {
+      const auto& threadPool = ThreadPool::getSharedInstance();
+      if (job.mapping.isTransposed) {
+        size_t tileRows = static_cast<size_t>((job.height + kTileSize - 1) / kTileSize);
+        threadPool->parallelFor(tileRows, 1, [&](size_t begin, size_t end) {
+          transposeTileRows<kBytesPerPixel>(job, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+        });
+      } else {
+        threadPool->parallelFor(static_cast<size_t>(job.height), kTileSize, [&](size_t begin, size_t end) {
+          copyRows<kBytesPerPixel>(job, static_cast<int32_t>(begin), static_cast<int32_t>(end));
+        });
+      }
+    }
+
+  } // namespace
+
+  void rotate(const uint8_t* source, int32_t width, int32_t height, size_t sourceBytesPerRow, uint8_t* destination,
+              size_t destinationBytesPerRow, size_t bytesPerPixel, const OrientationOptions& options) {
+    RotationJob job;
+    job.source = source;
+    job.width = width;
+    job.height = height;
+    job.sourceBytesPerRow = sourceBytesPerRow;
+    job.destination = destination;
+    job.bytesPerPixel = bytesPerPixel;
+    job.mapping = createPixelMapping(width, height, destinationBytesPerRow, bytesPerPixel, options);
+
+    switch (bytesPerPixel) {
+      case 1:
+        return rotate<1>(job);
+      case 2:
+        return rotate<2>(job);
+      case 3:
+        return rotate<3>(job);
+      case 4:
+        return rotate<4>(job);
+      default:
+        return rotate<0>(job);
+    }
+  }
+
+  std::shared_ptr<MutableRawBuffer> rotateToPooledBuffer(const uint8_t* source, int32_t width, int32_t height, size_t sourceBytesPerRow,
+                                                         size_t bytesPerPixel, const OrientationOptions& options) {
+    int32_t destinationWidth = options.isTransposed() ? height : width;
+    size_t destinationBytesPerRow = static_cast<size_t>(destinationWidth) * bytesPerPixel;
+    auto buffer = ArrayBufferPool::getSharedInstance()->acquire(destinationBytesPerRow * (options.isTransposed() ? width : height));
+    rotate(source, width, height, sourceBytesPerRow, buffer->data(), destinationBytesPerRow, bytesPerPixel, options);
+    return buffer;
+  }
+
+} // namespace ImageRotation
+
+} // namespace vision
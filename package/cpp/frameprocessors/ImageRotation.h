@@ -0,0 +1,83 @@
+//
+//  ImageRotation.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "FrameMetadata.h"
+#include "MutableRawBuffer.h"
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A clockwise rotation by a multiple of 90°.
+ */
+enum class RotationAngle {
+  Degrees0,
+  Degrees90,
+  Degrees180,
+  Degrees270,
+};
+
+/**
+ * Get the clockwise rotation that makes a Frame of the given orientation appear up-right, which counter-rotates
+ * the orientation (`portrait` = 0°, `landscape-left` = 90°, `portrait-upside-down` = 180°, `landscape-right` = 270°).
+ */
+RotationAngle getUprightRotation(FrameOrientation orientation);
+
+/**
+ * The `orientation` and `mirror` options of `Frame.toArrayBuffer(..)` and `Frame.resize(..)`.
+ */
+struct OrientationOptions {
+  RotationAngle rotation;
+  // Whether to flip the result horizontally after rotating it
+  bool mirror;
+
+  inline bool isIdentity() const {
+    return rotation == RotationAngle::Degrees0 && !mirror;
+  }
+  inline bool isTransposed() const {
+    return rotation == RotationAngle::Degrees90 || rotation == RotationAngle::Degrees270;
+  }
+};
+
+/**
+ * Parses `orientation` (`'upright'` or `'original'`) and `mirror` (`boolean`) of the options object passed as the first argument.
+ * If there is no options object, nothing is rotated. Throws a `jsi::JSError` if the options are invalid.
+ */
+OrientationOptions parseOrientationOptions(jsi::Runtime& runtime, const jsi::Value* arguments, size_t count, FrameOrientation orientation,
+                                           const char* methodName);
+
+namespace ImageRotation {
+
+  /**
+   * Rotates (and optionally mirrors) a packed image with pixels of `bytesPerPixel` bytes, e.g. a Y plane (1),
+   * an interleaved CbCr plane (2) or an RGBA image (4).
+   *
+   * The image is processed in cache-sized tiles on the shared `ThreadPool`, and 90°/270° rotations of 1 and 4 byte
+   * pixels transpose 8x8/4x4 blocks in SIMD registers. If the rotation is 90° or 270°, `destination` is
+   * `height` x `width` pixels. Source and destination must not overlap.
+   */
+  void rotate(const uint8_t* source, int32_t width, int32_t height, size_t sourceBytesPerRow, uint8_t* destination,
+              size_t destinationBytesPerRow, size_t bytesPerPixel, const OrientationOptions& options);
+
+  /**
+   * Rotates (and optionally mirrors) a packed image into a new, tightly packed buffer from the `ArrayBufferPool`.
+   */
+  std::shared_ptr<MutableRawBuffer> rotateToPooledBuffer(const uint8_t* source, int32_t width, int32_t height, size_t sourceBytesPerRow,
+                                                         size_t bytesPerPixel, const OrientationOptions& options);
+
+} // namespace ImageRotation
+
+} // namespace vision
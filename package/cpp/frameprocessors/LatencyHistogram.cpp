@@ -0,0 +1,112 @@
+//
+//  LatencyHistogram.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "LatencyHistogram.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace vision {
+
+LatencyHistogram::LatencyHistogram() {
+  for (auto& shard : _shards) {
+    for (auto& bucket : shard.buckets) {
+      bucket.store(0, std::memory_order_relaxed);
+    }
+    shard.sum.store(0, std::memory_order_relaxed);
+    shard.max.store(0, std::memory_order_relaxed);
+  }
+}
+
+size_t LatencyHistogram::getShardIndex() noexcept {
+  // Threads are spread over the shards in the order they first record, the same for all histograms.
+  static std::atomic<size_t> nextShardIndex{0};
+  static thread_local size_t shardIndex = nextShardIndex.fetch_add(1, std::memory_order_relaxed) % kShardsCount;
+  return shardIndex;
+}
+
+size_t LatencyHistogram::getBucketIndex(uint64_t microseconds) noexcept {
+  if (microseconds < kExactBucketsCount) {
+    return static_cast<size_t>(microseconds);
+  }
+  size_t magnitude = 63 - static_cast<size_t>(__builtin_clzll(microseconds));
+  if (magnitude > kMaxMagnitude) {
+    return kBucketsCount - 1;
+  }
+  // The next bits after the most significant one select the sub-bucket
+  size_t subBucket = static_cast<size_t>(microseconds >> (magnitude - kSubBucketsBits)) & (kSubBucketsCount - 1);
+  return kExactBucketsCount + (magnitude - 4) * kSubBucketsCount + subBucket;
+}
+
+double LatencyHistogram::getBucketMiddle(size_t index) noexcept {
+  if (index < kExactBucketsCount) {
+    return static_cast<double>(index);
+  }
+  size_t magnitude = 4 + (index - kExactBucketsCount) / kSubBucketsCount;
+  size_t subBucket = (index - kExactBucketsCount) % kSubBucketsCount;
+  double width = std::ldexp(1.0, static_cast<int>(magnitude - kSubBucketsBits));
+  double lowerBound = static_cast<double>(kSubBucketsCount + subBucket) * width;
+  return lowerBound + width / 2;
+}
+
+void LatencyHistogram::record(uint64_t microseconds) noexcept {
+  Shard& shard = _shards[getShardIndex()];
+  shard.buckets[getBucketIndex(microseconds)].fetch_add(1, std::memory_order_relaxed);
+  shard.sum.fetch_add(microseconds, std::memory_order_relaxed);
+  uint64_t max = shard.max.load(std::memory_order_relaxed);
+  while (microseconds > max && !shard.max.compare_exchange_weak(max, microseconds, std::memory_order_relaxed)) {
+  }
+}
+
+LatencyHistogram::Snapshot LatencyHistogram::getSnapshot(bool reset) {
+  auto read = [reset](std::atomic<uint64_t>& value) {
+    return reset ? value.exchange(0, std::memory_order_relaxed) : value.load(std::memory_order_relaxed);
+  };
+  std::array<uint64_t, kBucketsCount> counts{};
+  uint64_t count = 0;
+  uint64_t sum = 0;
+  uint64_t max = 0;
+  for (Shard& shard : _shards) {
+    for (size_t i = 0; i < kBucketsCount; i++) {
+      uint64_t bucketCount = read(shard.buckets[i]);
+      counts[i] += bucketCount;
+      count += bucketCount;
+    }
+    sum += read(shard.sum);
+    max = std::max(max, read(shard.max));
+  }
+
+  Snapshot snapshot;
+  snapshot.count = count;
+  if (count == 0) {
+    return snapshot;
+  }
+
+  // Concurrent record(..) calls might not be fully visible yet, so clamp everything to the recorded maximum.
+  double maxMs = static_cast<double>(max) / 1000.0;
+  auto getPercentile = [&](double percentile) {
+    uint64_t target = std::max<uint64_t>(static_cast<uint64_t>(std::ceil(percentile * static_cast<double>(count))), 1);
+    uint64_t cumulative = 0;
+    for (size_t i = 0; i < kBucketsCount; i++) {
+      cumulative += counts[i];
+      if (cumulative >= target) {
+        return std::min(getBucketMiddle(i) / 1000.0, maxMs);
+      }
+    }
+    return maxMs;
+  };
+
+  snapshot.mean = static_cast<double>(sum) / static_cast<double>(count) / 1000.0;
+  snapshot.p50 = getPercentile(0.5);
+  snapshot.p90 = getPercentile(0.9);
+  snapshot.p99 = getPercentile(0.99);
+  snapshot.max = maxMs;
+  return snapshot;
+}
+
+} // namespace vision
@@ -0,0 +1,100 @@
+//
+//  LatencyHistogram.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace vision {
+
+/**
+ * A lock-free histogram of durations in microseconds, for measuring hot paths such as Frame Processor calls.
+ *
+ * Values below 16µs are counted exactly, larger values in 8 buckets per power of two (at most 12.5% wide),
+ * up to ~2 hours. Recording a value only takes a few relaxed atomic operations and does not allocate.
+ *
+ * Every Thread records into one of a few cache-line aligned shards, so Threads that record concurrently (e.g. parallel
+ * Plugins on the `ThreadPool`) don't contend on the same buckets. Snapshots merge all shards.
+ */
+class LatencyHistogram {
+public:
+  struct Snapshot {
+    uint64_t count = 0;
+    // All durations are in milliseconds. Percentiles are the middle of the bucket they fall into.
+    double mean = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double max = 0;
+  };
+
+public:
+  LatencyHistogram();
+
+  LatencyHistogram(const LatencyHistogram&) = delete;
+  LatencyHistogram& operator=(const LatencyHistogram&) = delete;
+
+public:
+  /**
+   * Records a duration. Safe to call from any Thread.
+   */
+  void record(uint64_t microseconds) noexcept;
+
+  /**
+   * Get the count, mean, percentiles and maximum of all recorded durations.
+   * If `reset` is true, the histogram is cleared, so the next snapshot only contains durations recorded after this one.
+   */
+  Snapshot getSnapshot(bool reset = false);
+
+private:
+  static constexpr size_t kExactBucketsCount = 16;
+  static constexpr size_t kSubBucketsBits = 3;
+  static constexpr size_t kSubBucketsCount = 1 << kSubBucketsBits;
+  static constexpr size_t kMaxMagnitude = 32;
+  static constexpr size_t kBucketsCount = kExactBucketsCount + (kMaxMagnitude - 4 + 1) * kSubBucketsCount;
+
+  static constexpr size_t kShardsCount = 4;
+
+  struct alignas(64) Shard {
+    std::array<std::atomic<uint64_t>, kBucketsCount> buckets;
+    std::atomic<uint64_t> sum;
+    std::atomic<uint64_t> max;
+  };
+
+  static size_t getBucketIndex(uint64_t microseconds) noexcept;
+  static double getBucketMiddle(size_t index) noexcept;
+  static size_t getShardIndex() noexcept;
+
+private:
+  std::array<Shard, kShardsCount> _shards;
+};
+
+/**
+ * Records the time from construction to destruction into a `LatencyHistogram`, also if an exception is thrown.
+ */
+class ScopedLatencyTimer {
+public:
+  explicit ScopedLatencyTimer(LatencyHistogram& histogram) : _histogram(histogram), _start(std::chrono::steady_clock::now()) {}
+  ~ScopedLatencyTimer() {
+    auto duration = std::chrono::steady_clock::now() - _start;
+    _histogram.record(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count()));
+  }
+
+  ScopedLatencyTimer(const ScopedLatencyTimer&) = delete;
+  ScopedLatencyTimer& operator=(const ScopedLatencyTimer&) = delete;
+
+private:
+  LatencyHistogram& _histogram;
+  std::chrono::steady_clock::time_point _start;
+};
+
+} // namespace vision
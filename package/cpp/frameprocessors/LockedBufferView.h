@@ -0,0 +1,45 @@
+//
+//  LockedBufferView.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+#include <memory>
+#include <utility>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A `jsi::MutableBuffer` that points directly at the CPU-mapped memory of a locked platform buffer
+ * (`AHardwareBuffer` / `CVPixelBuffer`), used for `Frame.toArrayBuffer({ copy: false })`.
+ *
+ * The view shares ownership of the platform lock (`lock`), whose deleter unlocks and releases the platform
+ * buffer. This keeps the memory mapped for as long as the `ArrayBuffer` is alive in JS, so JS never reads
+ * unmapped memory - even if the Frame has been closed in the meantime.
+ */
+class LockedBufferView : public jsi::MutableBuffer {
+public:
+  explicit LockedBufferView(std::shared_ptr<void> lock, uint8_t* data, size_t size) : _lock(std::move(lock)), _data(data), _size(size) {}
+
+public:
+  uint8_t* data() override {
+    return _data;
+  }
+  size_t size() const override {
+    return _size;
+  }
+
+private:
+  std::shared_ptr<void> _lock;
+  uint8_t* _data;
+  size_t _size;
+};
+
+} // namespace vision
@@ -0,0 +1,106 @@
+//
+//  MPSCQueue.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <atomic>
+#include <optional>
+#include <utility>
+
+namespace vision {
+
+/**
+ * An unbounded lock-free multi-producer single-consumer queue (Vyukov's intrusive MPSC queue).
+ *
+ * Any Thread can `push(..)` without taking a lock, only one Thread at a time may `pop()`.
+ * Values are only ever moved, never copied. Every `push(..)` allocates one node.
+ *
+ * A value is only visible to the consumer once its `push(..)` returned, so a consumer that is woken up after a
+ * `push(..)` always sees it. While another `push(..)` is still in progress, `pop()` may return `std::nullopt` early.
+ */
+template <typename T> class MPSCQueue {
+public:
+  MPSCQueue() : _head(&_stub), _tail(&_stub) {}
+  ~MPSCQueue() {
+    while (pop().has_value()) {
+    }
+  }
+
+  MPSCQueue(const MPSCQueue&) = delete;
+  MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+public:
+  /**
+   * Enqueues the given value. Safe to call from any Thread.
+   */
+  void push(T&& value) {
+    pushNode(new Node(std::move(value)));
+  }
+
+  /**
+   * Dequeues the oldest value, or returns `std::nullopt` if there is none. Must only be called from the consumer Thread.
+   */
+  std::optional<T> pop() {
+    Node* tail = _tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+    if (tail == &_stub) {
+      if (next == nullptr) {
+        return std::nullopt;
+      }
+      // Skip the stub
+      _tail = next;
+      tail = next;
+      next = next->next.load(std::memory_order_acquire);
+    }
+    if (next != nullptr) {
+      _tail = next;
+      return take(tail);
+    }
+    if (tail != _head.load(std::memory_order_acquire)) {
+      // A producer is in the middle of a push(..)
+      return std::nullopt;
+    }
+    // tail is the last node, put the stub behind it so it can be taken out
+    pushNode(&_stub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next != nullptr) {
+      _tail = next;
+      return take(tail);
+    }
+    return std::nullopt;
+  }
+
+private:
+  struct Node {
+    Node() : next(nullptr) {}
+    explicit Node(T&& value) : next(nullptr), value(std::move(value)) {}
+
+    std::atomic<Node*> next;
+    std::optional<T> value;
+  };
+
+  void pushNode(Node* node) {
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* previous = _head.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+  }
+
+  static std::optional<T> take(Node* node) {
+    std::optional<T> value = std::move(node->value);
+    delete node;
+    return value;
+  }
+
+private:
+  // Producers append at the head, the consumer takes from the tail.
+  std::atomic<Node*> _head;
+  Node* _tail;
+  Node _stub;
+};
+
+} // namespace vision
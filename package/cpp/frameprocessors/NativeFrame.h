@@ -0,0 +1,84 @@
+//
+//  NativeFrame.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "FrameMetadata.h"
+#include "FramePlane.h"
+#include "PixelConversion.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A reference on the platform buffer of a Frame (`AHardwareBuffer*` / `CVPixelBufferRef`), used for `Frame.getNativeBuffer()`.
+ */
+struct NativeBuffer {
+  uintptr_t pointer;
+  // Releases the reference `getNativeBuffer()` acquired, if any
+  std::function<void()> release;
+};
+
+/**
+ * A platform-independent view of a single Camera Frame, e.g. an `ImageProxy` on Android, a `CMSampleBuffer` on iOS,
+ * or a synthetic Frame (see `SyntheticFrameSource`).
+ */
+class NativeFrame {
+public:
+  virtual ~NativeFrame() = default;
+
+public:
+  /**
+   * All metadata of this Frame, the same fields `Frame` exposes to JS.
+   */
+  virtual const FrameMetadata& getMetadata() const = 0;
+  /**
+   * Whether the underlying platform Frame can still be accessed.
+   */
+  virtual bool getIsValid() const = 0;
+
+  /**
+   * Locks all planes of this Frame for CPU reads.
+   * The planes stay valid for as long as `lock` is alive - releasing the last reference on it unlocks them again.
+   * Throws a `std::runtime_error` if the Frame cannot be locked.
+   */
+  virtual std::vector<FramePlane> lockPlanes(std::shared_ptr<void>& lock) = 0;
+  /**
+   * Locks the whole buffer of this Frame for CPU reads, and returns its address and `size` in bytes.
+   * The buffer stays valid for as long as `lock` is alive. Throws a `std::runtime_error` if the Frame cannot be locked.
+   */
+  virtual uint8_t* lockBuffer(std::shared_ptr<void>& lock, size_t& size) = 0;
+  /**
+   * Acquires a reference on the platform buffer of this Frame.
+   * Throws a `std::runtime_error` if the Frame is not backed by a platform buffer.
+   */
+  virtual NativeBuffer getNativeBuffer() = 0;
+
+  /**
+   * The channel order of packed (single-plane) RGB Frames.
+   */
+  virtual PixelLayout getPackedLayout() const = 0;
+  /**
+   * Whether YUV Frames use the full [0...255] range instead of the video range [16...235].
+   */
+  virtual bool getIsFullRange() const = 0;
+
+  /**
+   * Holds a reference on the underlying platform Frame, so it is not recycled by the Camera pipeline.
+   * Balance every call with `release()`.
+   */
+  virtual void retain() = 0;
+  virtual void release() = 0;
+};
+
+} // namespace vision
@@ -0,0 +1,77 @@
+//
+//  NativeState.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "NativeState.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+void NativeStateRegistry::setFrameProcessorStates(int viewTag, const std::vector<std::string>& names) {
+  std::vector<std::shared_ptr<NativeState>> states;
+  states.reserve(names.size());
+  {
+    std::unique_lock lock(_mutex);
+    for (const std::string& name : names) {
+      std::weak_ptr<NativeState>& entry = _states[name];
+      std::shared_ptr<NativeState> state = entry.lock();
+      if (state == nullptr) {
+        state = std::make_shared<NativeState>(name);
+        entry = state;
+      }
+      states.push_back(std::move(state));
+    }
+  }
+  setStates(viewTag, std::move(states));
+}
+
+void NativeStateRegistry::removeFrameProcessorStates(int viewTag) {
+  setStates(viewTag, {});
+}
+
+void NativeStateRegistry::setStates(int viewTag, std::vector<std::shared_ptr<NativeState>>&& states) {
+  std::vector<std::shared_ptr<NativeState>> previousStates;
+  {
+    std::unique_lock lock(_mutex);
+    auto it = _frameProcessorStates.find(viewTag);
+    if (it != _frameProcessorStates.end()) {
+      previousStates = std::move(it->second);
+      _frameProcessorStates.erase(it);
+    }
+    if (!states.empty()) {
+      _frameProcessorStates.emplace(viewTag, std::move(states));
+    }
+  }
+
+  // The previous slots are released outside of the lock, their values might be expensive to tear down.
+  previousStates.clear();
+
+  std::unique_lock lock(_mutex);
+  for (auto it = _states.begin(); it != _states.end();) {
+    if (it->second.expired()) {
+      it = _states.erase(it);
+    } else {
+      ++it;
+    }
+  }
+}
+
+std::shared_ptr<NativeState> NativeStateRegistry::get(const std::string& name) const {
+  std::unique_lock lock(_mutex);
+  auto it = _states.find(name);
+  if (it == _states.end()) {
+    return nullptr;
+  }
+  return it->second.lock();
+}
+
+} // namespace vision
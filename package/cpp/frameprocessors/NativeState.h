@@ -0,0 +1,147 @@
+//
+//  NativeState.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A named slot for native state that Frame Processor Plugins keep across Frames, e.g. an object tracker or the previous
+ * Frame's features for optical flow.
+ *
+ * JS creates a handle with `VisionCameraProxy.createNativeState(name)`, and the slot lives as long as a Frame Processor
+ * that captures the handle is set on a Camera. Plugins look it up by name through the `VisionCameraProxy`, so the
+ * state itself never has to be converted to JS.
+ *
+ * Accessing the slot is thread-safe, accessing the value inside of it is up to the Plugin.
+ */
+class NativeState {
+public:
+  explicit NativeState(std::string name) : _name(std::move(name)) {}
+
+  NativeState(const NativeState&) = delete;
+  NativeState& operator=(const NativeState&) = delete;
+
+public:
+  inline const std::string& getName() const noexcept {
+    return _name;
+  }
+
+  bool hasValue() const {
+    std::unique_lock lock(_mutex);
+    return _value != nullptr;
+  }
+
+  /**
+   * Get the value of this slot, or `nullptr` if it is empty.
+   * Throws if the slot holds a value of a different type.
+   */
+  template <typename T> std::shared_ptr<T> get() const {
+    std::unique_lock lock(_mutex);
+    assertType<T>();
+    return std::static_pointer_cast<T>(_value);
+  }
+
+  /**
+   * Get the value of this slot, or create it with the given constructor arguments if it is empty.
+   * Throws if the slot holds a value of a different type.
+   */
+  template <typename T, typename... Args> std::shared_ptr<T> getOrCreate(Args&&... args) {
+    std::unique_lock lock(_mutex);
+    assertType<T>();
+    if (_value == nullptr) {
+      _value = std::make_shared<T>(std::forward<Args>(args)...);
+      _type = &typeid(T);
+    }
+    return std::static_pointer_cast<T>(_value);
+  }
+
+  /**
+   * Replaces the value of this slot, which may also be of a different type than before.
+   */
+  template <typename T> void set(std::shared_ptr<T> value) {
+    std::shared_ptr<void> previousValue;
+    {
+      std::unique_lock lock(_mutex);
+      previousValue = std::move(_value);
+      _value = std::move(value);
+      _type = _value != nullptr ? &typeid(T) : nullptr;
+    }
+    // The previous value is destroyed outside of the lock, it might be expensive to tear down.
+  }
+
+  /**
+   * Clears this slot, e.g. to restart tracking. Plugins still holding the previous value keep it alive.
+   */
+  void reset() {
+    set<void>(nullptr);
+  }
+
+private:
+  template <typename T> void assertType() const {
+    if (_type != nullptr && *_type != typeid(T)) {
+      throw std::runtime_error("NativeState \"" + _name + "\" holds a value of a different type!");
+    }
+  }
+
+private:
+  std::string _name;
+  mutable std::mutex _mutex;
+  std::shared_ptr<void> _value;
+  const std::type_info* _type = nullptr;
+};
+
+/**
+ * The `NativeState` slots of one `VisionCameraProxy`, by name.
+ *
+ * The slots are owned by the Frame Processors that use them, by view. A slot is created when the first Frame Processor
+ * that uses it is set, and released once no Frame Processor uses it anymore (and no Plugin still holds on to it).
+ */
+class NativeStateRegistry {
+public:
+  NativeStateRegistry() = default;
+
+  NativeStateRegistry(const NativeStateRegistry&) = delete;
+  NativeStateRegistry& operator=(const NativeStateRegistry&) = delete;
+
+public:
+  /**
+   * Sets the slots the Frame Processor of the given view uses. Missing slots are created, and the ones that were only
+   * used by the view's previous Frame Processor are released.
+   */
+  void setFrameProcessorStates(int viewTag, const std::vector<std::string>& names);
+
+  /**
+   * Releases the slots of the given view's Frame Processor, unless another Frame Processor uses them too.
+   */
+  void removeFrameProcessorStates(int viewTag);
+
+  /**
+   * Get the slot with the given name, or `nullptr` if no Frame Processor uses one.
+   */
+  std::shared_ptr<NativeState> get(const std::string& name) const;
+
+private:
+  void setStates(int viewTag, std::vector<std::shared_ptr<NativeState>>&& states);
+
+private:
+  mutable std::mutex _mutex;
+  std::unordered_map<std::string, std::weak_ptr<NativeState>> _states;
+  std::unordered_map<int, std::vector<std::shared_ptr<NativeState>>> _frameProcessorStates;
+};
+
+} // namespace vision
@@ -0,0 +1,88 @@
+//
+//  NativeStateHostObject.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "NativeStateHostObject.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+// Frame Processors are wrapped once (Frame ref-counting), plugins or helper worklets might add a few more levels.
+static constexpr size_t kMaxClosureDepth = 4;
+
+std::vector<jsi::PropNameID> NativeStateHostObject::getPropertyNames(jsi::Runtime& runtime) {
+  return jsi::PropNameID::names(runtime, "name", "hasValue", "reset", "toString");
+}
+
+jsi::Value NativeStateHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  auto name = propName.utf8(runtime);
+
+  if (name == "name") {
+    return jsi::String::createFromUtf8(runtime, _name);
+  } else if (name == "hasValue") {
+    auto state = _registry->get(_name);
+    return jsi::Value(state != nullptr && state->hasValue());
+  } else if (name == "reset") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "reset"), 0,
+        [registry = _registry, name = _name](jsi::Runtime&, const jsi::Value&, const jsi::Value*, size_t) -> jsi::Value {
+          auto state = registry->get(name);
+          if (state != nullptr) {
+            state->reset();
+          }
+          return jsi::Value::undefined();
+        });
+  } else if (name == "toString") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "toString"), 0,
+        [name = _name](jsi::Runtime& runtime, const jsi::Value&, const jsi::Value*, size_t) -> jsi::Value {
+          return jsi::String::createFromUtf8(runtime, "[NativeState " + name + "]");
+        });
+  }
+
+  return jsi::Value::undefined();
+}
+
+static void collectCapturedNames(jsi::Runtime& runtime, const jsi::Object& worklet, size_t depth, std::vector<std::string>& names) {
+  // The worklets babel plugin stores the captured variables of a worklet in its `__closure` object.
+  jsi::Value closureValue = worklet.getProperty(runtime, "__closure");
+  if (!closureValue.isObject()) {
+    return;
+  }
+  jsi::Object closure = closureValue.getObject(runtime);
+  jsi::Array keys = closure.getPropertyNames(runtime);
+  size_t size = keys.size(runtime);
+  for (size_t i = 0; i < size; i++) {
+    jsi::String key = keys.getValueAtIndex(runtime, i).getString(runtime);
+    jsi::Value value = closure.getProperty(runtime, jsi::PropNameID::forString(runtime, key));
+    if (!value.isObject()) {
+      continue;
+    }
+    jsi::Object object = value.getObject(runtime);
+    if (object.isHostObject<NativeStateHostObject>(runtime)) {
+      const std::string& name = object.getHostObject<NativeStateHostObject>(runtime)->getName();
+      if (std::find(names.begin(), names.end(), name) == names.end()) {
+        names.push_back(name);
+      }
+    } else if (depth < kMaxClosureDepth && object.isFunction(runtime)) {
+      collectCapturedNames(runtime, object, depth + 1, names);
+    }
+  }
+}
+
+std::vector<std::string> NativeStateHostObject::getCapturedNames(jsi::Runtime& runtime, const jsi::Function& worklet) {
+  std::vector<std::string> names;
+  collectCapturedNames(runtime, worklet, 0, names);
+  return names;
+}
+
+} // namespace vision
@@ -0,0 +1,53 @@
+//
+//  NativeStateHostObject.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include "NativeState.h"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * The opaque JS handle of a `NativeState` slot (`VisionCameraProxy.createNativeState(name)`).
+ * The handle does not own the slot, the Frame Processors that capture it do. Its value is never exposed to JS.
+ */
+class JSI_EXPORT NativeStateHostObject : public jsi::HostObject {
+public:
+  explicit NativeStateHostObject(std::shared_ptr<NativeStateRegistry> registry, std::string name)
+      : _registry(std::move(registry)), _name(std::move(name)) {}
+
+public:
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
+
+public:
+  inline const std::string& getName() const noexcept {
+    return _name;
+  }
+
+  /**
+   * Get the names of the `NativeState` handles the given Frame Processor worklet captures, either directly or through
+   * a worklet it calls.
+   */
+  static std::vector<std::string> getCapturedNames(jsi::Runtime& runtime, const jsi::Function& worklet);
+
+private:
+  std::shared_ptr<NativeStateRegistry> _registry;
+  std::string _name;
+};
+
+} // namespace vision
@@ -0,0 +1,67 @@
+//
+//  ObjectShape.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ObjectShape.h"
+#include "TypedArray.h"
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+ObjectShape::ObjectShape(jsi::Runtime& runtime, const jsi::Object& object) {
+  jsi::Array propertyNames = object.getPropertyNames(runtime);
+  size_t size = propertyNames.size(runtime);
+  _strings.reserve(size);
+  _propNames.reserve(size);
+  _names.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    jsi::String name = propertyNames.getValueAtIndex(runtime, i).asString(runtime);
+    _names.push_back(name.utf8(runtime));
+    _propNames.push_back(jsi::PropNameID::forString(runtime, name));
+    _strings.push_back(std::move(name));
+  }
+}
+
+bool ObjectShape::isPlainObject(jsi::Runtime& runtime, const jsi::Object& object) {
+  if (object.isArray(runtime) || object.isArrayBuffer(runtime) || object.isFunction(runtime) || object.isHostObject(runtime)) {
+    return false;
+  }
+  // TypedArrays are converted to primitive arrays
+  return !TypedArrays::getView(runtime, object).has_value();
+}
+
+bool ObjectShape::matches(jsi::Runtime& runtime, const jsi::Object& object) const {
+  jsi::Array propertyNames = object.getPropertyNames(runtime);
+  size_t size = propertyNames.size(runtime);
+  if (size != _strings.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < size; i++) {
+    jsi::Value name = propertyNames.getValueAtIndex(runtime, i);
+    if (!name.isString() || !jsi::String::strictEquals(runtime, name.getString(runtime), _strings[i])) {
+      return false;
+    }
+  }
+  return true;
+}
+
+size_t ObjectShape::size() const {
+  return _names.size();
+}
+
+const std::string& ObjectShape::getName(size_t index) const {
+  return _names[index];
+}
+
+const jsi::PropNameID& ObjectShape::getPropName(size_t index) const {
+  return _propNames[index];
+}
+
+} // namespace vision
@@ -0,0 +1,83 @@
+//
+//  ObjectShape.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * The ordered property names of a plain JS object.
+ *
+ * Arrays of similarly-shaped objects (e.g. bounding boxes) are converted by matching every element against the shape
+ * of the first one, which compares the property names inside the JS engine instead of encoding every key again.
+ */
+class ObjectShape {
+public:
+  ObjectShape(jsi::Runtime& runtime, const jsi::Object& object);
+
+public:
+  /**
+   * Whether the object is a plain object (not an Array, ArrayBuffer, TypedArray, Function or HostObject) that is converted to a map.
+   */
+  static bool isPlainObject(jsi::Runtime& runtime, const jsi::Object& object);
+
+  /**
+   * Whether the given plain object has exactly the same property names in the same order.
+   */
+  bool matches(jsi::Runtime& runtime, const jsi::Object& object) const;
+
+  size_t size() const;
+  const std::string& getName(size_t index) const;
+  const jsi::PropNameID& getPropName(size_t index) const;
+
+private:
+  std::vector<jsi::String> _strings;
+  std::vector<jsi::PropNameID> _propNames;
+  std::vector<std::string> _names;
+};
+
+/**
+ * Caches the native representation (e.g. a `jstring` or an `NSString*`) of property names per `jsi::Runtime`,
+ * so keys that appear in every call are only encoded once. Use it through `RuntimeCache<PropertyKeyCache<TKey>>`.
+ */
+template <typename TKey> class PropertyKeyCache {
+public:
+  explicit PropertyKeyCache(jsi::Runtime&) {}
+
+  /**
+   * Gets the cached key for `name`, or creates it with `create(name)`.
+   * The reference is only valid until the next call, as the cache is cleared once it holds too many keys.
+   */
+  template <typename TCreate> const TKey& get(const std::string& name, TCreate&& create) {
+    auto entry = _keys.find(name);
+    if (entry != _keys.end()) {
+      return entry->second;
+    }
+    if (_keys.size() >= kMaxKeysCount) {
+      // Objects used as dictionaries (e.g. keyed by IDs) would otherwise grow the cache forever.
+      _keys.clear();
+    }
+    return _keys.emplace(name, create(name)).first->second;
+  }
+
+private:
+  static constexpr size_t kMaxKeysCount = 512;
+  std::unordered_map<std::string, TKey> _keys;
+};
+
+} // namespace vision
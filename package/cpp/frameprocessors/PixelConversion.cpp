@@ -0,0 +1,398 @@
+//
+//  PixelConversion.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "PixelConversion.h"
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <string>
+
+#if defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define VISION_PIXEL_CONVERSION_NEON 1
+#include <arm_neon.h>
+#elif defined(__SSE2__) || defined(_M_X64)
+#define VISION_PIXEL_CONVERSION_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace vision {
+
+size_t getBytesPerPixel(PixelLayout layout) {
+  switch (layout) {
+    case PixelLayout::RGB:
+    case PixelLayout::BGR:
+      return 3;
+    case PixelLayout::RGBA:
+    case PixelLayout::BGRA:
+      return 4;
+    case PixelLayout::Gray:
+      return 1;
+  }
+  return 4;
+}
+
+std::optional<PixelLayout> parsePixelLayout(const std::string& string) {
+  if (string == "rgb") {
+    return PixelLayout::RGB;
+  } else if (string == "rgba") {
+    return PixelLayout::RGBA;
+  } else if (string == "bgr") {
+    return PixelLayout::BGR;
+  } else if (string == "bgra") {
+    return PixelLayout::BGRA;
+  } else if (string == "gray") {
+    return PixelLayout::Gray;
+  }
+  return std::nullopt;
+}
+
+namespace PixelConversion {
+
+  // BT.601 YUV -> RGB in 6-bit fixed point. Every product fits into int16 and sums are saturated (which only happens
+  // far above 255), so the SIMD kernels can compute 8 lanes at once and produce exactly the same results as the scalar
+  // implementation.
+  //   R = Y' + rv * V
+  //   G = Y' - gu * U - gv * V
+  //   B = Y' + bu * U
+  // Full range:  Y' = Y,                rv = 1.402, gu = 0.344, gv = 0.714, bu = 1.772
+  // Video range: Y' = 1.164 * (Y - 16), rv = 1.596, gu = 0.391, gv = 0.813, bu = 2.018
+  struct ColorTransform {
+    int16_t yOffset;
+    int16_t yScale;
+    int16_t rv;
+    int16_t gu;
+    int16_t gv;
+    int16_t bu;
+  };
+
+  static ColorTransform getColorTransform(bool isFullRange) {
+    return isFullRange ? ColorTransform{0, 64, 90, 22, 46, 113} : ColorTransform{16, 75, 102, 25, 52, 129};
+  }
+
+  // BT.601 luma weights in 8-bit fixed point, used for RGB -> Gray
+  static constexpr uint16_t kGrayR = 77;
+  static constexpr uint16_t kGrayG = 150;
+  static constexpr uint16_t kGrayB = 29;
+
+  static inline uint8_t clampToByte(int32_t value) {
+    return static_cast<uint8_t>(std::min(std::max(value, 0), 255));
+  }
+
+  static inline void writePixel(uint8_t* destination, PixelLayout layout, uint8_t r, uint8_t g, uint8_t b) {
+    switch (layout) {
+      case PixelLayout::RGB:
+        destination[0] = r;
+        destination[1] = g;
+        destination[2] = b;
+        break;
+      case PixelLayout::BGR:
+        destination[0] = b;
+        destination[1] = g;
+        destination[2] = r;
+        break;
+      case PixelLayout::RGBA:
+        destination[0] = r;
+        destination[1] = g;
+        destination[2] = b;
+        destination[3] = 255;
+        break;
+      case PixelLayout::BGRA:
+        destination[0] = b;
+        destination[1] = g;
+        destination[2] = r;
+        destination[3] = 255;
+        break;
+      case PixelLayout::Gray:
+        destination[0] = static_cast<uint8_t>((kGrayR * r + kGrayG * g + kGrayB * b + 128) >> 8);
+        break;
+    }
+  }
+
+  // Scalar YUV row, converts pixels [from, to).
+  static void convertYUVRowScalar(const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t uvPixelStride, uint8_t* destination,
+                                  int32_t from, int32_t to, ColorTransform transform, PixelLayout layout) {
+    size_t bytesPerPixel = getBytesPerPixel(layout);
+    for (int32_t x = from; x < to; x++) {
+      int32_t chromaOffset = (x >> 1) * uvPixelStride;
+      int32_t yy = (static_cast<int32_t>(y[x]) - transform.yOffset) * transform.yScale;
+      int32_t d = static_cast<int32_t>(u[chromaOffset]) - 128;
+      int32_t e = static_cast<int32_t>(v[chromaOffset]) - 128;
+      uint8_t r = clampToByte((yy + transform.rv * e + 32) >> 6);
+      uint8_t g = clampToByte((yy - transform.gu * d - transform.gv * e + 32) >> 6);
+      uint8_t b = clampToByte((yy + transform.bu * d + 32) >> 6);
+      writePixel(destination + x * bytesPerPixel, layout, r, g, b);
+    }
+  }
+
+  // Returns the number of pixels that have been converted with SIMD, the rest has to be converted by the scalar kernel.
+  static int32_t convertYUVRowSIMD(const uint8_t* y, const uint8_t* u, const uint8_t* v, int32_t uvPixelStride, uint8_t* destination,
+                                   int32_t width, ColorTransform transform, PixelLayout layout) {
+    if (uvPixelStride != 1 && uvPixelStride != 2) {
+      return 0;
+    }
+    // Semi-planar chroma is loaded 16 bytes at a time, the last load needs one byte of headroom for the second channel.
+    int32_t end = uvPixelStride == 2 ? width - 1 : width;
+    int32_t x = 0;
+
+#if VISION_PIXEL_CONVERSION_NEON
+    const int16x8_t offset = vdupq_n_s16(transform.yOffset);
+    for (; x + 16 <= end; x += 16) {
+      uint8x16_t yValues = vld1q_u8(y + x);
+      uint8x8_t uValues, vValues;
+      if (uvPixelStride == 1) {
+        uValues = vld1_u8(u + x / 2);
+        vValues = vld1_u8(v + x / 2);
+      } else {
+        uValues = vld2_u8(u + x).val[0];
+        vValues = vld2_u8(v + x).val[0];
+      }
+      int16x8_t d = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(uValues)), vdupq_n_s16(128));
+      int16x8_t e = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vValues)), vdupq_n_s16(128));
+
+      // Chroma contributions, duplicated for the two pixels sharing a chroma sample
+      int16x8_t rChromaValues = vmulq_n_s16(e, transform.rv);
+      int16x8x2_t rChroma = vzipq_s16(rChromaValues, rChromaValues);
+      int16x8_t gChromaValues = vmlaq_n_s16(vmulq_n_s16(d, transform.gu), e, transform.gv);
+      int16x8x2_t gChroma = vzipq_s16(gChromaValues, gChromaValues);
+      int16x8_t bChromaValues = vmulq_n_s16(d, transform.bu);
+      int16x8x2_t bChroma = vzipq_s16(bChromaValues, bChromaValues);
+
+      int16x8_t yLow = vmulq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(yValues))), offset), transform.yScale);
+      int16x8_t yHigh = vmulq_n_s16(vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(yValues))), offset), transform.yScale);
+
+      // (value + 32) >> 6, saturated to [0...255]
+      uint8x16_t r = vcombine_u8(vqrshrun_n_s16(vqaddq_s16(yLow, rChroma.val[0]), 6), vqrshrun_n_s16(vqaddq_s16(yHigh, rChroma.val[1]), 6));
+      uint8x16_t g = vcombine_u8(vqrshrun_n_s16(vqsubq_s16(yLow, gChroma.val[0]), 6), vqrshrun_n_s16(vqsubq_s16(yHigh, gChroma.val[1]), 6));
+      uint8x16_t b = vcombine_u8(vqrshrun_n_s16(vqaddq_s16(yLow, bChroma.val[0]), 6), vqrshrun_n_s16(vqaddq_s16(yHigh, bChroma.val[1]), 6));
+
+      switch (layout) {
+        case PixelLayout::RGB: {
+          uint8x16x3_t pixels = {{r, g, b}};
+          vst3q_u8(destination + x * 3, pixels);
+          break;
+        }
+        case PixelLayout::BGR: {
+          uint8x16x3_t pixels = {{b, g, r}};
+          vst3q_u8(destination + x * 3, pixels);
+          break;
+        }
+        case PixelLayout::RGBA: {
+          uint8x16x4_t pixels = {{r, g, b, vdupq_n_u8(255)}};
+          vst4q_u8(destination + x * 4, pixels);
+          break;
+        }
+        case PixelLayout::BGRA: {
+          uint8x16x4_t pixels = {{b, g, r, vdupq_n_u8(255)}};
+          vst4q_u8(destination + x * 4, pixels);
+          break;
+        }
+        case PixelLayout::Gray:
+          // Gray is a plain copy of the Y plane, this is never called.
+          return 0;
+      }
+    }
+#elif VISION_PIXEL_CONVERSION_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i chromaBias = _mm_set1_epi16(128);
+    const __m128i rounding = _mm_set1_epi16(32);
+    const __m128i lumaOffset = _mm_set1_epi16(transform.yOffset);
+    const __m128i lumaScale = _mm_set1_epi16(transform.yScale);
+    const __m128i alpha = _mm_set1_epi8(static_cast<char>(0xFF));
+    alignas(16) uint8_t channels[3][16];
+
+    for (; x + 16 <= end; x += 16) {
+      __m128i yValues = _mm_loadu_si128(reinterpret_cast<const __m128i*>(y + x));
+      __m128i uValues, vValues;
+      if (uvPixelStride == 1) {
+        uValues = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(u + x / 2)), zero);
+        vValues = _mm_unpacklo_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v + x / 2)), zero);
+      } else {
+        const __m128i lowByteMask = _mm_set1_epi16(0x00FF);
+        uValues = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(u + x)), lowByteMask);
+        vValues = _mm_and_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v + x)), lowByteMask);
+      }
+      __m128i d = _mm_sub_epi16(uValues, chromaBias);
+      __m128i e = _mm_sub_epi16(vValues, chromaBias);
+
+      __m128i rChroma = _mm_mullo_epi16(e, _mm_set1_epi16(transform.rv));
+      __m128i gChroma = _mm_add_epi16(_mm_mullo_epi16(d, _mm_set1_epi16(transform.gu)), _mm_mullo_epi16(e, _mm_set1_epi16(transform.gv)));
+      __m128i bChroma = _mm_mullo_epi16(d, _mm_set1_epi16(transform.bu));
+
+      __m128i yLow = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpacklo_epi8(yValues, zero), lumaOffset), lumaScale);
+      __m128i yHigh = _mm_mullo_epi16(_mm_sub_epi16(_mm_unpackhi_epi8(yValues, zero), lumaOffset), lumaScale);
+
+      // (value + 32) >> 6, saturated to [0...255]. Chroma is duplicated for the two pixels sharing a chroma sample.
+      auto toBytes = [&](__m128i low, __m128i high) {
+        return _mm_packus_epi16(_mm_srai_epi16(_mm_adds_epi16(low, rounding), 6), _mm_srai_epi16(_mm_adds_epi16(high, rounding), 6));
+      };
+      __m128i r = toBytes(_mm_adds_epi16(yLow, _mm_unpacklo_epi16(rChroma, rChroma)),
+                          _mm_adds_epi16(yHigh, _mm_unpackhi_epi16(rChroma, rChroma)));
+      __m128i g = toBytes(_mm_subs_epi16(yLow, _mm_unpacklo_epi16(gChroma, gChroma)),
+                          _mm_subs_epi16(yHigh, _mm_unpackhi_epi16(gChroma, gChroma)));
+      __m128i b = toBytes(_mm_adds_epi16(yLow, _mm_unpacklo_epi16(bChroma, bChroma)),
+                          _mm_adds_epi16(yHigh, _mm_unpackhi_epi16(bChroma, bChroma)));
+
+      switch (layout) {
+        case PixelLayout::RGBA:
+        case PixelLayout::BGRA: {
+          __m128i first = layout == PixelLayout::RGBA ? r : b;
+          __m128i third = layout == PixelLayout::RGBA ? b : r;
+          __m128i firstSecondLow = _mm_unpacklo_epi8(first, g);
+          __m128i firstSecondHigh = _mm_unpackhi_epi8(first, g);
+          __m128i thirdAlphaLow = _mm_unpacklo_epi8(third, alpha);
+          __m128i thirdAlphaHigh = _mm_unpackhi_epi8(third, alpha);
+          __m128i* output = reinterpret_cast<__m128i*>(destination + x * 4);
+          _mm_storeu_si128(output + 0, _mm_unpacklo_epi16(firstSecondLow, thirdAlphaLow));
+          _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(firstSecondLow, thirdAlphaLow));
+          _mm_storeu_si128(output + 2, _mm_unpacklo_epi16(firstSecondHigh, thirdAlphaHigh));
+          _mm_storeu_si128(output + 3, _mm_unpackhi_epi16(firstSecondHigh, thirdAlphaHigh));
+          break;
+        }
+        case PixelLayout::RGB:
+        case PixelLayout::BGR: {
+          // SSE2 has no 3-channel interleaving store, so only the interleaving is scalar.
+          _mm_store_si128(reinterpret_cast<__m128i*>(channels[0]), layout == PixelLayout::RGB ? r : b);
+          _mm_store_si128(reinterpret_cast<__m128i*>(channels[1]), g);
+          _mm_store_si128(reinterpret_cast<__m128i*>(channels[2]), layout == PixelLayout::RGB ? b : r);
+          uint8_t* output = destination + x * 3;
+          for (int i = 0; i < 16; i++) {
+            output[i * 3 + 0] = channels[0][i];
+            output[i * 3 + 1] = channels[1][i];
+            output[i * 3 + 2] = channels[2][i];
+          }
+          break;
+        }
+        case PixelLayout::Gray:
+          // Gray is a plain copy of the Y plane, this is never called.
+          return 0;
+      }
+    }
+#endif
+
+    return x;
+  }
+
+  void convert(const YUVImageView& source, uint8_t* destination, size_t destinationBytesPerRow, PixelLayout layout) {
+    ColorTransform transform = getColorTransform(source.isFullRange);
+
+    for (int32_t row = 0; row < source.height; row++) {
+      const uint8_t* y = source.y + static_cast<size_t>(row) * source.yBytesPerRow;
+      uint8_t* output = destination + static_cast<size_t>(row) * destinationBytesPerRow;
+
+      if (layout == PixelLayout::Gray) {
+        // The Y plane already is the grayscale image
+        memcpy(output, y, source.width);
+        continue;
+      }
+
+      size_t chromaRowOffset = static_cast<size_t>(row >> 1) * source.uvBytesPerRow;
+      const uint8_t* u = source.u + chromaRowOffset;
+      const uint8_t* v = source.v + chromaRowOffset;
+
+      int32_t converted = convertYUVRowSIMD(y, u, v, source.uvPixelStride, output, source.width, transform, layout);
+      convertYUVRowScalar(y, u, v, source.uvPixelStride, output, converted, source.width, transform, layout);
+    }
+  }
+
+  static void convertPackedRowScalar(const uint8_t* source, PixelLayout sourceLayout, uint8_t* destination, int32_t from, int32_t to,
+                                     PixelLayout layout) {
+    size_t bytesPerPixel = getBytesPerPixel(layout);
+    bool isBGRA = sourceLayout == PixelLayout::BGRA;
+    for (int32_t x = from; x < to; x++) {
+      const uint8_t* pixel = source + x * 4;
+      uint8_t r = isBGRA ? pixel[2] : pixel[0];
+      uint8_t b = isBGRA ? pixel[0] : pixel[2];
+      writePixel(destination + x * bytesPerPixel, layout, r, pixel[1], b);
+    }
+  }
+
+  static int32_t convertPackedRowSIMD(const uint8_t* source, PixelLayout sourceLayout, uint8_t* destination, int32_t width,
+                                      PixelLayout layout) {
+    int32_t x = 0;
+#if VISION_PIXEL_CONVERSION_NEON
+    bool isBGRA = sourceLayout == PixelLayout::BGRA;
+    for (; x + 16 <= width; x += 16) {
+      uint8x16x4_t pixels = vld4q_u8(source + x * 4);
+      uint8x16_t r = isBGRA ? pixels.val[2] : pixels.val[0];
+      uint8x16_t g = pixels.val[1];
+      uint8x16_t b = isBGRA ? pixels.val[0] : pixels.val[2];
+
+      switch (layout) {
+        case PixelLayout::RGB: {
+          uint8x16x3_t output = {{r, g, b}};
+          vst3q_u8(destination + x * 3, output);
+          break;
+        }
+        case PixelLayout::BGR: {
+          uint8x16x3_t output = {{b, g, r}};
+          vst3q_u8(destination + x * 3, output);
+          break;
+        }
+        case PixelLayout::RGBA: {
+          uint8x16x4_t output = {{r, g, b, vdupq_n_u8(255)}};
+          vst4q_u8(destination + x * 4, output);
+          break;
+        }
+        case PixelLayout::BGRA: {
+          uint8x16x4_t output = {{b, g, r, vdupq_n_u8(255)}};
+          vst4q_u8(destination + x * 4, output);
+          break;
+        }
+        case PixelLayout::Gray: {
+          // (77 * r + 150 * g + 29 * b + 128) >> 8
+          uint16x8_t low = vmull_u8(vget_low_u8(r), vdup_n_u8(kGrayR));
+          low = vmlal_u8(low, vget_low_u8(g), vdup_n_u8(kGrayG));
+          low = vmlal_u8(low, vget_low_u8(b), vdup_n_u8(kGrayB));
+          uint16x8_t high = vmull_u8(vget_high_u8(r), vdup_n_u8(kGrayR));
+          high = vmlal_u8(high, vget_high_u8(g), vdup_n_u8(kGrayG));
+          high = vmlal_u8(high, vget_high_u8(b), vdup_n_u8(kGrayB));
+          vst1q_u8(destination + x, vcombine_u8(vrshrn_n_u16(low, 8), vrshrn_n_u16(high, 8)));
+          break;
+        }
+      }
+    }
+#else
+    // Channel shuffles without SSSE3 (pshufb) are not faster than the scalar loop.
+    (void)source;
+    (void)sourceLayout;
+    (void)destination;
+    (void)width;
+    (void)layout;
+#endif
+    return x;
+  }
+
+  void convert(const PackedImageView& source, uint8_t* destination, size_t destinationBytesPerRow, PixelLayout layout) {
+    for (int32_t row = 0; row < source.height; row++) {
+      const uint8_t* input = source.data + static_cast<size_t>(row) * source.bytesPerRow;
+      uint8_t* output = destination + static_cast<size_t>(row) * destinationBytesPerRow;
+
+      if (layout == source.layout) {
+        memcpy(output, input, static_cast<size_t>(source.width) * 4);
+        continue;
+      }
+
+      int32_t converted = convertPackedRowSIMD(input, source.layout, output, source.width, layout);
+      convertPackedRowScalar(input, source.layout, output, converted, source.width, layout);
+    }
+  }
+
+  const char* getKernelName() {
+#if VISION_PIXEL_CONVERSION_NEON
+    return "neon";
+#elif VISION_PIXEL_CONVERSION_SSE2
+    return "sse2";
+#else
+    return "scalar";
+#endif
+  }
+
+} // namespace PixelConversion
+
+} // namespace vision
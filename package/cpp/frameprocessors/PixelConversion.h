@@ -0,0 +1,92 @@
+//
+//  PixelConversion.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace vision {
+
+/**
+ * The channel layout of a tightly packed 8-bit pixel.
+ */
+enum class PixelLayout {
+  RGB,
+  RGBA,
+  BGR,
+  BGRA,
+  Gray,
+};
+
+/**
+ * Get the number of bytes a single pixel of the given layout takes.
+ */
+size_t getBytesPerPixel(PixelLayout layout);
+
+/**
+ * Parses a JS pixel layout string (`"rgb"`, `"rgba"`, `"bgr"`, `"bgra"` or `"gray"`).
+ */
+std::optional<PixelLayout> parsePixelLayout(const std::string& string);
+
+/**
+ * A read-only view into an 8-bit YUV 4:2:0 image.
+ *
+ * The chroma planes are described with a pixel stride, so this covers planar (I420, `uvPixelStride` = 1)
+ * as well as semi-planar images (NV12/NV21, `uvPixelStride` = 2 and `v` = `u` ± 1).
+ */
+struct YUVImageView {
+  int32_t width;
+  int32_t height;
+  const uint8_t* y;
+  int32_t yBytesPerRow;
+  const uint8_t* u;
+  const uint8_t* v;
+  int32_t uvBytesPerRow;
+  int32_t uvPixelStride;
+  // Whether the image uses the full [0...255] range (JPEG), or the video range [16...235] (BT.601).
+  bool isFullRange;
+};
+
+/**
+ * A read-only view into a packed 8-bit 4-channel image (`RGBA` or `BGRA`).
+ */
+struct PackedImageView {
+  int32_t width;
+  int32_t height;
+  const uint8_t* data;
+  int32_t bytesPerRow;
+  PixelLayout layout;
+};
+
+namespace PixelConversion {
+
+  /**
+   * Converts a YUV 4:2:0 image to the given layout using BT.601 coefficients.
+   * `destination` has to hold at least `destinationBytesPerRow * height` bytes.
+   *
+   * The result is bit-exact across the NEON, SSE2 and scalar implementations.
+   */
+  void convert(const YUVImageView& source, uint8_t* destination, size_t destinationBytesPerRow, PixelLayout layout);
+
+  /**
+   * Converts a packed `RGBA` or `BGRA` image to the given layout.
+   * `destination` has to hold at least `destinationBytesPerRow * height` bytes.
+   */
+  void convert(const PackedImageView& source, uint8_t* destination, size_t destinationBytesPerRow, PixelLayout layout);
+
+  /**
+   * Get the name of the SIMD instruction set the conversion kernels have been compiled for (`"neon"`, `"sse2"` or `"scalar"`).
+   */
+  const char* getKernelName();
+
+} // namespace PixelConversion
+
+} // namespace vision
@@ -0,0 +1,131 @@
+//
+//  PluginOptionsCache.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "PluginOptionsCache.h"
+#include "TypedArray.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+namespace PluginOptions {
+
+  static std::atomic<uint64_t> conversions{0};
+  static std::atomic<uint64_t> cacheHits{0};
+
+  Stats getStats() {
+    Stats stats;
+    stats.conversions = conversions.load(std::memory_order_relaxed);
+    stats.cacheHits = cacheHits.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+  void recordConversion() {
+    conversions.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void recordCacheHit() {
+    cacheHits.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  template <typename T> static void appendRaw(std::string& fingerprint, T value) {
+    char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    fingerprint.append(bytes, sizeof(T));
+  }
+
+  static void appendString(std::string& fingerprint, const std::string& string) {
+    // Length-prefixed, so a string cannot be mistaken for the following tags
+    appendRaw(fingerprint, static_cast<uint32_t>(string.size()));
+    fingerprint.append(string);
+  }
+
+  static bool appendValue(jsi::Runtime& runtime, const jsi::Value& value, std::string& fingerprint);
+
+  static bool appendObject(jsi::Runtime& runtime, const jsi::Object& object, std::string& fingerprint) {
+    if (object.isArray(runtime)) {
+      jsi::Array array = object.getArray(runtime);
+      size_t size = array.size(runtime);
+      fingerprint.push_back('a');
+      appendRaw(fingerprint, static_cast<uint32_t>(size));
+      for (size_t i = 0; i < size; i++) {
+        if (!appendValue(runtime, array.getValueAtIndex(runtime, i), fingerprint)) {
+          return false;
+        }
+      }
+      return true;
+    }
+    if (object.isArrayBuffer(runtime) || object.isHostObject(runtime) || object.isFunction(runtime) ||
+        TypedArrays::getView(runtime, object).has_value()) {
+      // The contents of ArrayBuffers, TypedArrays and HostObjects (e.g. Frames) can change without the object changing.
+      return false;
+    }
+
+    jsi::Array propertyNames = object.getPropertyNames(runtime);
+    size_t size = propertyNames.size(runtime);
+    fingerprint.push_back('o');
+    appendRaw(fingerprint, static_cast<uint32_t>(size));
+    for (size_t i = 0; i < size; i++) {
+      jsi::String propName = propertyNames.getValueAtIndex(runtime, i).asString(runtime);
+      appendString(fingerprint, propName.utf8(runtime));
+      if (!appendValue(runtime, object.getProperty(runtime, propName), fingerprint)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  static bool appendValue(jsi::Runtime& runtime, const jsi::Value& value, std::string& fingerprint) {
+    if (value.isUndefined() || value.isNull()) {
+      // Both are converted to null
+      fingerprint.push_back('u');
+      return true;
+    } else if (value.isBool()) {
+      fingerprint.push_back(value.getBool() ? 't' : 'f');
+      return true;
+    } else if (value.isNumber()) {
+      fingerprint.push_back('n');
+      appendRaw(fingerprint, value.getNumber());
+      return true;
+    } else if (value.isString()) {
+      fingerprint.push_back('s');
+      appendString(fingerprint, value.getString(runtime).utf8(runtime));
+      return true;
+    } else if (value.isObject()) {
+      return appendObject(runtime, value.getObject(runtime), fingerprint);
+    }
+    return false;
+  }
+
+  bool getFingerprint(jsi::Runtime& runtime, const jsi::Object& options, std::string& fingerprint) {
+    return appendObject(runtime, options, fingerprint);
+  }
+
+  bool getPropertySnapshots(jsi::Runtime& runtime, const jsi::Object& options, std::vector<PropertySnapshot>& snapshots) {
+    jsi::Array propertyNames = options.getPropertyNames(runtime);
+    size_t size = propertyNames.size(runtime);
+    snapshots.reserve(size);
+    for (size_t i = 0; i < size; i++) {
+      jsi::PropNameID name = jsi::PropNameID::forString(runtime, propertyNames.getValueAtIndex(runtime, i).asString(runtime));
+      jsi::Value value = options.getProperty(runtime, name);
+      if (value.isObject()) {
+        return false;
+      }
+      snapshots.push_back(PropertySnapshot{std::move(name), std::move(value)});
+    }
+    return true;
+  }
+
+} // namespace PluginOptions
+
+} // namespace vision
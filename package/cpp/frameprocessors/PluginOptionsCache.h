@@ -0,0 +1,186 @@
+//
+//  PluginOptionsCache.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+namespace PluginOptions {
+
+  struct Stats {
+    // Number of options objects that had to be converted to a native map
+    uint64_t conversions = 0;
+    // Number of calls that could reuse a previously converted native map
+    uint64_t cacheHits = 0;
+  };
+
+  Stats getStats();
+  void recordConversion();
+  void recordCacheHit();
+
+  /**
+   * Serializes the structure and values of an options object into `fingerprint`, without touching the native side.
+   * Returns `false` if the options contain values that cannot be compared structurally (e.g. `ArrayBuffer`s, TypedArrays,
+   * Frames or other HostObjects), in which case they must be converted on every call.
+   */
+  bool getFingerprint(jsi::Runtime& runtime, const jsi::Object& options, std::string& fingerprint);
+
+  /**
+   * A property of an options object, and the primitive value it had when the options were converted.
+   */
+  struct PropertySnapshot {
+    jsi::PropNameID name;
+    jsi::Value value;
+  };
+
+  /**
+   * Snapshots all properties of an options object, or returns `false` if any of them is not a primitive (e.g. a nested
+   * object or array) and therefore cannot be compared cheaply.
+   */
+  bool getPropertySnapshots(jsi::Runtime& runtime, const jsi::Object& options, std::vector<PropertySnapshot>& snapshots);
+
+  /**
+   * Attached to an options object as `jsi::NativeState` once it has been converted, so passing the same object again
+   * skips both the fingerprint (enumerating and UTF-8 encoding every key) and the conversion.
+   *
+   * In-place changes of the snapshotted properties are still detected, since every property is compared with its
+   * snapshot. Properties that are added to the object later are not, so pass a new object to add options.
+   */
+  template <typename TNativeOptions> class ConvertedOptions : public jsi::NativeState {
+  public:
+    ConvertedOptions(TNativeOptions value, std::vector<PropertySnapshot> snapshots)
+        : _value(std::move(value)), _snapshots(std::move(snapshots)) {}
+
+  public:
+    const TNativeOptions& getValue() const {
+      return _value;
+    }
+
+    /**
+     * Whether all properties of `options` still have the values they had when the options were converted.
+     */
+    bool matches(jsi::Runtime& runtime, const jsi::Object& options) const {
+      for (const PropertySnapshot& snapshot : _snapshots) {
+        if (!jsi::Value::strictEquals(runtime, options.getProperty(runtime, snapshot.name), snapshot.value)) {
+          return false;
+        }
+      }
+      return true;
+    }
+
+  private:
+    TNativeOptions _value;
+    std::vector<PropertySnapshot> _snapshots;
+  };
+
+} // namespace PluginOptions
+
+/**
+ * Memoizes the conversion of the options passed to a Frame Processor Plugin's `call(..)`.
+ *
+ * Most Plugins get the same constant options every Frame, so instead of building a new native map (boxing every value)
+ * per call, the last converted map is reused as long as the options are structurally equal.
+ * If the same flat options object is passed again, it is recognized by its `ConvertedOptions` marker without computing
+ * a fingerprint at all.
+ * `TNativeOptions` is the platform's converted options type, and must be cheap to copy (e.g. a `shared_ptr` or an `NSDictionary*`).
+ * Since one converted value is handed to every call, the converter must return an immutable value.
+ */
+template <typename TNativeOptions> class PluginOptionsCache {
+public:
+  template <typename TConverter> TNativeOptions get(jsi::Runtime& runtime, const jsi::Object& options, TConverter&& convert) {
+    using Marker = PluginOptions::ConvertedOptions<TNativeOptions>;
+    if (options.hasNativeState<Marker>(runtime)) {
+      // Identity fast path: the same options object as in a previous call
+      auto marker = options.getNativeState<Marker>(runtime);
+      if (marker->matches(runtime, options)) {
+        PluginOptions::recordCacheHit();
+        return marker->getValue();
+      }
+    }
+
+    // Reused per Thread to avoid reallocating the fingerprint on every call
+    thread_local std::string fingerprint;
+    fingerprint.clear();
+    bool isCacheable = PluginOptions::getFingerprint(runtime, options, fingerprint);
+    if (isCacheable) {
+      std::unique_lock lock(_mutex);
+      if (_value.has_value() && _fingerprint == fingerprint) {
+        PluginOptions::recordCacheHit();
+        return *_value;
+      }
+    }
+
+    // Convert outside of the lock, the Plugin might be called from multiple Runtimes.
+    TNativeOptions value = convert(runtime, options);
+    PluginOptions::recordConversion();
+    if (isCacheable) {
+      std::unique_lock lock(_mutex);
+      _fingerprint = fingerprint;
+      _value = value;
+    }
+    if (!options.hasNativeState(runtime)) {
+      mark(runtime, options, value);
+    }
+    return value;
+  }
+
+  void clear() {
+    std::unique_lock lock(_mutex);
+    _value = std::nullopt;
+    _fingerprint.clear();
+  }
+
+private:
+  static void mark(jsi::Runtime& runtime, const jsi::Object& options, const TNativeOptions& value) {
+    std::vector<PluginOptions::PropertySnapshot> snapshots;
+    if (!PluginOptions::getPropertySnapshots(runtime, options, snapshots)) {
+      return;
+    }
+    try {
+      options.setNativeState(runtime, std::make_shared<PluginOptions::ConvertedOptions<TNativeOptions>>(value, std::move(snapshots)));
+    } catch (const jsi::JSIException&) {
+      // e.g. frozen objects or Proxies cannot hold NativeState, they just keep going through the fingerprint.
+    }
+  }
+
+private:
+  std::mutex _mutex;
+  std::string _fingerprint;
+  std::optional<TNativeOptions> _value;
+};
+
+/**
+ * Options that have been converted once with `plugin.prepare(options)`, and can be passed to every `plugin.call(..)`
+ * without comparing or converting them again.
+ */
+template <typename TNativeOptions> class PreparedPluginOptions : public jsi::HostObject {
+public:
+  explicit PreparedPluginOptions(TNativeOptions options) : _options(std::move(options)) {}
+
+public:
+  const TNativeOptions& getOptions() const {
+    return _options;
+  }
+
+private:
+  TNativeOptions _options;
+};
+
+} // namespace vision
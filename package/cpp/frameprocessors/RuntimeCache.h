@@ -0,0 +1,96 @@
+//
+//  RuntimeCache.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace vision {
+
+using namespace facebook;
+
+namespace detail {
+  // Shared by all RuntimeCache<T> instantiations so every cache gets a unique property name in `global`.
+  inline std::atomic<size_t> nextRuntimeCacheId{0};
+} // namespace detail
+
+/**
+ * Holds one lazily created instance of `T` per `jsi::Runtime`.
+ *
+ * Frame Processors can run on multiple Runtimes (the Frame Processor Runtime, `runAsync` contexts or the JS Runtime),
+ * and values such as `jsi::PropNameID` or `jsi::Function` can only be used on the Runtime that created them.
+ * `T` needs a constructor that takes a `jsi::Runtime&`.
+ *
+ * When the Runtime gets destroyed, the entry is removed from the cache. The instance itself is leaked on purpose, since
+ * `jsi` values must not be released while their Runtime is tearing down.
+ */
+template <typename T> class RuntimeCache {
+public:
+  static T& get(jsi::Runtime& runtime) {
+    // Fast path: lookups almost always come from the same Runtime as the previous lookup on this Thread.
+    thread_local jsi::Runtime* lastRuntime = nullptr;
+    thread_local T* lastValue = nullptr;
+    thread_local size_t lastGeneration = 0;
+    if (lastRuntime == &runtime && lastGeneration == _generation.load(std::memory_order_acquire)) {
+      return *lastValue;
+    }
+
+    std::unique_lock lock(_mutex);
+    T*& value = _values[&runtime];
+    if (value == nullptr) {
+      value = new T(runtime);
+      installTeardownListener(runtime);
+    }
+    lastRuntime = &runtime;
+    lastValue = value;
+    lastGeneration = _generation.load(std::memory_order_acquire);
+    return *value;
+  }
+
+private:
+  /**
+   * A non-enumerable HostObject in `global` which gets destroyed together with the Runtime.
+   */
+  class TeardownListener : public jsi::HostObject {
+  public:
+    explicit TeardownListener(jsi::Runtime* runtime) : _runtime(runtime) {}
+    ~TeardownListener() {
+      std::unique_lock lock(_mutex);
+      _values.erase(_runtime);
+      // Invalidates the Thread-local fast paths, as a new Runtime might get allocated at the same address.
+      _generation.fetch_add(1, std::memory_order_release);
+    }
+
+  private:
+    jsi::Runtime* _runtime;
+  };
+
+  static void installTeardownListener(jsi::Runtime& runtime) {
+    static const std::string propName = "__visionCameraRuntimeCache" + std::to_string(detail::nextRuntimeCacheId++);
+    auto listener = std::make_shared<TeardownListener>(&runtime);
+    // Defined like `Object.defineProperty(global, name, { value })`, which makes it non-enumerable, read-only and
+    // non-configurable, so it neither shows up in `Object.keys(global)` nor can it be deleted by accident.
+    jsi::Object descriptor(runtime);
+    descriptor.setProperty(runtime, "value", jsi::Object::createFromHostObject(runtime, listener));
+    jsi::Function defineProperty = runtime.global().getPropertyAsObject(runtime, "Object").getPropertyAsFunction(runtime, "defineProperty");
+    defineProperty.call(runtime, runtime.global(), jsi::String::createFromAscii(runtime, propName.c_str()), descriptor);
+  }
+
+private:
+  static inline std::mutex _mutex;
+  static inline std::unordered_map<jsi::Runtime*, T*> _values;
+  static inline std::atomic<size_t> _generation{0};
+};
+
+} // namespace vision
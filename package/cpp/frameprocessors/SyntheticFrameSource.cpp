@@ -0,0 +1,198 @@
+//
+//  SyntheticFrameSource.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+
+namespace vision {
+
+// Camera buffers usually pad their rows to a multiple of 64 bytes
+static constexpr int32_t kRowAlignment = 64;
+
+static int32_t alignRow(int32_t bytes) {
+  return (bytes + kRowAlignment - 1) / kRowAlignment * kRowAlignment;
+}
+
+static FramePlane getPlane(const std::vector<uint8_t>& data, const SyntheticFrame::PlaneLayout& layout) {
+  FramePlane plane;
+  // The pixel data is only ever read, FramePlane is just not const-correct.
+  plane.data = const_cast<uint8_t*>(data.data()) + layout.offset;
+  plane.width = layout.width;
+  plane.height = layout.height;
+  plane.bytesPerRow = layout.bytesPerRow;
+  plane.pixelStride = layout.pixelStride;
+  return plane;
+}
+
+SyntheticFrame::SyntheticFrame(const FrameMetadata& metadata, std::shared_ptr<const std::vector<uint8_t>> data,
+                               std::vector<PlaneLayout> planes, PixelLayout packedLayout, bool isFullRange)
+    : _metadata(metadata), _data(std::move(data)), _planes(std::move(planes)), _packedLayout(packedLayout), _isFullRange(isFullRange) {
+  if (_data == nullptr) {
+    throw std::invalid_argument("SyntheticFrame: Pixel data cannot be null!");
+  }
+  for (size_t i = 0; i < _planes.size(); i++) {
+    const PlaneLayout& layout = _planes[i];
+    FramePlane plane = getPlane(*_data, layout);
+    if (layout.offset > _data->size() || plane.getSize() > _data->size() - layout.offset) {
+      throw std::invalid_argument("SyntheticFrame: Plane #" + std::to_string(i) + " lies outside of the pixel data!");
+    }
+  }
+}
+
+std::shared_ptr<SyntheticFrame> SyntheticFrame::createTestPattern(int32_t width, int32_t height, FramePixelFormat pixelFormat,
+                                                                  uint32_t index) {
+  if (width <= 0 || height <= 0) {
+    throw std::invalid_argument("SyntheticFrame: Invalid size " + std::to_string(width) + " x " + std::to_string(height) + "!");
+  }
+
+  std::vector<PlaneLayout> planes;
+  std::vector<uint8_t> data;
+  if (pixelFormat == FramePixelFormat::YUV) {
+    int32_t bytesPerRow = alignRow(width);
+    int32_t chromaWidth = (width + 1) / 2;
+    int32_t chromaHeight = (height + 1) / 2;
+    size_t lumaSize = static_cast<size_t>(bytesPerRow) * height;
+    data.resize(lumaSize + static_cast<size_t>(bytesPerRow) * chromaHeight);
+    for (int32_t y = 0; y < height; y++) {
+      uint8_t* row = data.data() + static_cast<size_t>(y) * bytesPerRow;
+      for (int32_t x = 0; x < width; x++) {
+        row[x] = static_cast<uint8_t>(x + y + index * 4);
+      }
+    }
+    for (int32_t y = 0; y < chromaHeight; y++) {
+      uint8_t* row = data.data() + lumaSize + static_cast<size_t>(y) * bytesPerRow;
+      for (int32_t x = 0; x < chromaWidth; x++) {
+        row[x * 2] = static_cast<uint8_t>(x * 2 + index);
+        row[x * 2 + 1] = static_cast<uint8_t>(y * 2 + index);
+      }
+    }
+    planes.push_back(PlaneLayout{0, width, height, bytesPerRow, 1});
+    planes.push_back(PlaneLayout{lumaSize, chromaWidth, chromaHeight, bytesPerRow, 2});
+  } else if (pixelFormat == FramePixelFormat::RGB) {
+    int32_t bytesPerRow = alignRow(width * 4);
+    data.resize(static_cast<size_t>(bytesPerRow) * height);
+    for (int32_t y = 0; y < height; y++) {
+      uint8_t* row = data.data() + static_cast<size_t>(y) * bytesPerRow;
+      for (int32_t x = 0; x < width; x++) {
+        row[x * 4] = static_cast<uint8_t>(x + index * 4);
+        row[x * 4 + 1] = static_cast<uint8_t>(y + index * 4);
+        row[x * 4 + 2] = static_cast<uint8_t>(x + y);
+        row[x * 4 + 3] = 255;
+      }
+    }
+    planes.push_back(PlaneLayout{0, width, height, bytesPerRow, 4});
+  } else {
+    throw std::invalid_argument("SyntheticFrame: Test patterns can only be generated in YUV or RGB!");
+  }
+
+  FrameMetadata metadata;
+  metadata.width = width;
+  metadata.height = height;
+  metadata.bytesPerRow = planes[0].bytesPerRow;
+  metadata.planesCount = static_cast<int32_t>(planes.size());
+  metadata.timestamp = 0;
+  metadata.orientation = FrameOrientation::Portrait;
+  metadata.pixelFormat = pixelFormat;
+  metadata.isMirrored = false;
+
+  auto sharedData = std::make_shared<const std::vector<uint8_t>>(std::move(data));
+  return std::make_shared<SyntheticFrame>(metadata, std::move(sharedData), std::move(planes));
+}
+
+std::vector<FramePlane> SyntheticFrame::lockPlanes(std::shared_ptr<void>& lock) {
+  // The planes stay valid for as long as someone holds on to the pixel data.
+  lock = std::shared_ptr<void>(_data, const_cast<uint8_t*>(_data->data()));
+
+  std::vector<FramePlane> planes;
+  planes.reserve(_planes.size());
+  for (const PlaneLayout& layout : _planes) {
+    planes.push_back(getPlane(*_data, layout));
+  }
+  return planes;
+}
+
+uint8_t* SyntheticFrame::lockBuffer(std::shared_ptr<void>& lock, size_t& size) {
+  lock = std::shared_ptr<void>(_data, const_cast<uint8_t*>(_data->data()));
+  size = _data->size();
+  return const_cast<uint8_t*>(_data->data());
+}
+
+NativeBuffer SyntheticFrame::getNativeBuffer() {
+  throw std::runtime_error("Synthetic Frames are not backed by a platform buffer!");
+}
+
+std::shared_ptr<SyntheticFrame> SyntheticFrame::withTimestamp(double timestamp) const {
+  auto frame = std::make_shared<SyntheticFrame>(*this);
+  frame->_metadata.timestamp = timestamp;
+  return frame;
+}
+
+SyntheticFrameSource::SyntheticFrameSource(std::vector<std::shared_ptr<SyntheticFrame>> frames) : _frames(std::move(frames)) {
+  if (_frames.empty()) {
+    throw std::invalid_argument("SyntheticFrameSource: At least one Frame is required!");
+  }
+}
+
+SyntheticFrameSource::Result SyntheticFrameSource::run(const Options& options, const Consumer& consumer) const {
+  using Clock = std::chrono::steady_clock;
+
+  Result result;
+  LatencyHistogram queueingDelay;
+  LatencyHistogram processingTime;
+
+  auto deliver = [&](size_t index, Clock::time_point captureTime) {
+    double timestamp = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(captureTime.time_since_epoch()).count());
+    std::shared_ptr<NativeFrame> frame = _frames[index % _frames.size()]->withTimestamp(timestamp);
+
+    auto delay = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - captureTime);
+    queueingDelay.record(static_cast<uint64_t>(delay.count()));
+    {
+      ScopedLatencyTimer timer(processingTime);
+      consumer(frame);
+    }
+    result.delivered++;
+  };
+
+  auto start = Clock::now();
+  if (options.targetFps <= 0) {
+    // Max throughput: Capture the next Frame as soon as the consumer is ready for it.
+    for (size_t i = 0; i < options.framesCount; i++) {
+      deliver(i, Clock::now());
+    }
+  } else {
+    auto interval = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(1.0 / options.targetFps));
+    interval = std::max(interval, Clock::duration(1));
+    size_t index = 0;
+    while (index < options.framesCount) {
+      auto captureTime = start + interval * static_cast<Clock::rep>(index);
+      std::this_thread::sleep_until(captureTime);
+      deliver(index, captureTime);
+
+      // Out of all Frames that were captured while the consumer was busy, only the latest one is kept.
+      auto latestCaptured = static_cast<size_t>((Clock::now() - start) / interval);
+      size_t next = std::min(std::max(index + 1, latestCaptured), options.framesCount);
+      result.dropped += next - index - 1;
+      index = next;
+    }
+  }
+
+  auto duration = std::chrono::duration<double, std::milli>(Clock::now() - start);
+  result.durationMs = duration.count();
+  result.fps = result.durationMs > 0 ? static_cast<double>(result.delivered) / (result.durationMs / 1000.0) : 0;
+  result.queueingDelay = queueingDelay.getSnapshot();
+  result.processingTime = processingTime.getSnapshot();
+  return result;
+}
+
+} // namespace vision
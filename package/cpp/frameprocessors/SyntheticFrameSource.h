@@ -0,0 +1,134 @@
+//
+//  SyntheticFrameSource.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "LatencyHistogram.h"
+#include "NativeFrame.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A Frame whose pixel data lives in memory instead of a Camera buffer, e.g. a recorded or a generated Frame.
+ *
+ * The pixel data is read-only and shared between all copies of a `SyntheticFrame`, so the same recording can be
+ * replayed many times without copying it.
+ */
+class SyntheticFrame : public NativeFrame {
+public:
+  /**
+   * The location of a single plane inside the pixel data.
+   */
+  struct PlaneLayout {
+    size_t offset;
+    int32_t width;
+    int32_t height;
+    int32_t bytesPerRow;
+    int32_t pixelStride;
+  };
+
+public:
+  /**
+   * Wraps recorded pixel data. Throws a `std::invalid_argument` if a plane lies outside of `data`.
+   */
+  SyntheticFrame(const FrameMetadata& metadata, std::shared_ptr<const std::vector<uint8_t>> data, std::vector<PlaneLayout> planes,
+                 PixelLayout packedLayout = PixelLayout::RGBA, bool isFullRange = true);
+
+  /**
+   * Generates a deterministic test pattern Frame - a gradient that moves with `index`.
+   * YUV Frames have two planes (Y and interleaved CbCr, like `420v`/`NV12`), RGB Frames a single RGBA plane.
+   */
+  static std::shared_ptr<SyntheticFrame> createTestPattern(int32_t width, int32_t height, FramePixelFormat pixelFormat, uint32_t index);
+
+public:
+  const FrameMetadata& getMetadata() const override {
+    return _metadata;
+  }
+  bool getIsValid() const override {
+    return true;
+  }
+  std::vector<FramePlane> lockPlanes(std::shared_ptr<void>& lock) override;
+  uint8_t* lockBuffer(std::shared_ptr<void>& lock, size_t& size) override;
+  NativeBuffer getNativeBuffer() override;
+  PixelLayout getPackedLayout() const override {
+    return _packedLayout;
+  }
+  bool getIsFullRange() const override {
+    return _isFullRange;
+  }
+  // The pixel data is owned by the Frame itself, there is no platform Frame that could be recycled.
+  void retain() override {}
+  void release() override {}
+
+  /**
+   * Creates a copy of this Frame that shares the pixel data, but has a different timestamp.
+   */
+  std::shared_ptr<SyntheticFrame> withTimestamp(double timestamp) const;
+
+private:
+  FrameMetadata _metadata;
+  std::shared_ptr<const std::vector<uint8_t>> _data;
+  std::vector<PlaneLayout> _planes;
+  PixelLayout _packedLayout;
+  bool _isFullRange;
+};
+
+/**
+ * Replays a fixed set of Frames into a consumer (e.g. a Frame Processor) to benchmark it with a reproducible input.
+ *
+ * With a `targetFps`, Frames are captured at a fixed rate just like a Camera does. If the consumer is still busy when
+ * a Frame is captured, only the latest Frame is kept and all older ones are dropped (like CameraX's `KEEP_ONLY_LATEST`).
+ * With a `targetFps` of 0 ("max throughput"), the next Frame is delivered as soon as the consumer returned, which
+ * measures the sustainable frame rate of the consumer.
+ */
+class SyntheticFrameSource {
+public:
+  struct Options {
+    // The rate Frames are captured at, or 0 to deliver Frames as fast as the consumer can process them
+    double targetFps = 30;
+    // The number of Frames to capture (including dropped Frames)
+    size_t framesCount = 300;
+  };
+
+  struct Result {
+    uint64_t delivered = 0;
+    uint64_t dropped = 0;
+    // The wall-clock duration of the whole run, and the rate Frames were delivered at
+    double durationMs = 0;
+    double fps = 0;
+    // The time from capturing a Frame until the consumer received it
+    LatencyHistogram::Snapshot queueingDelay;
+    // The time the consumer took per Frame
+    LatencyHistogram::Snapshot processingTime;
+  };
+
+  using Consumer = std::function<void(const std::shared_ptr<NativeFrame>& frame)>;
+
+public:
+  /**
+   * Creates a source that replays the given Frames in a loop. Throws a `std::invalid_argument` if `frames` is empty.
+   */
+  explicit SyntheticFrameSource(std::vector<std::shared_ptr<SyntheticFrame>> frames);
+
+  /**
+   * Delivers Frames to `consumer` on the calling Thread, and returns once all Frames have been captured.
+   * Frame timestamps are nanoseconds of the steady clock. If `consumer` throws, the run is aborted.
+   */
+  Result run(const Options& options, const Consumer& consumer) const;
+
+private:
+  std::vector<std::shared_ptr<SyntheticFrame>> _frames;
+};
+
+} // namespace vision
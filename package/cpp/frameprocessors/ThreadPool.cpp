@@ -0,0 +1,149 @@
+//
+//  ThreadPool.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ThreadPool.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <utility>
+
+namespace vision {
+
+ThreadPool::ThreadPool(size_t threadsCount, WorkerScope workerScope) {
+  _threads.reserve(threadsCount);
+  for (size_t i = 0; i < threadsCount; i++) {
+    if (workerScope != nullptr) {
+      _threads.emplace_back([this, workerScope]() { workerScope([this]() { workerLoop(); }); });
+    } else {
+      _threads.emplace_back([this]() { workerLoop(); });
+    }
+  }
+}
+
+ThreadPool::~ThreadPool() {
+  {
+    std::unique_lock lock(_mutex);
+    _isStopped = true;
+  }
+  _condition.notify_all();
+  for (auto& thread : _threads) {
+    thread.join();
+  }
+}
+
+static ThreadPool::WorkerScope& getSharedWorkerScope() {
+  static ThreadPool::WorkerScope workerScope = nullptr;
+  return workerScope;
+}
+
+const std::shared_ptr<ThreadPool>& ThreadPool::getSharedInstance() {
+  static const std::shared_ptr<ThreadPool> instance = []() {
+    size_t cores = std::max(std::thread::hardware_concurrency(), 1u);
+    // The Thread that calls parallelFor(..) also does work, and more than 4 workers only saturate memory bandwidth.
+    size_t threadsCount = std::min<size_t>(cores - 1, 4);
+    return std::make_shared<ThreadPool>(threadsCount, getSharedWorkerScope());
+  }();
+  return instance;
+}
+
+void ThreadPool::setSharedWorkerScope(WorkerScope workerScope) {
+  getSharedWorkerScope() = std::move(workerScope);
+}
+
+void ThreadPool::run(std::function<void()> task) {
+  {
+    std::unique_lock lock(_mutex);
+    _tasks.push(std::move(task));
+  }
+  _condition.notify_one();
+}
+
+void ThreadPool::workerLoop() {
+  while (true) {
+    std::function<void()> task;
+    {
+      std::unique_lock lock(_mutex);
+      _condition.wait(lock, [this]() { return _isStopped || !_tasks.empty(); });
+      if (_isStopped && _tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop();
+    }
+    task();
+  }
+}
+
+void ThreadPool::parallelFor(size_t count, size_t chunkSize, const std::function<void(size_t begin, size_t end)>& task) {
+  chunkSize = std::max<size_t>(chunkSize, 1);
+  size_t chunksCount = (count + chunkSize - 1) / chunkSize;
+  size_t helpersCount = std::min(_threads.size(), chunksCount > 0 ? chunksCount - 1 : 0);
+  if (helpersCount == 0) {
+    // Not worth waking up any workers
+    if (count > 0) {
+      task(0, count);
+    }
+    return;
+  }
+
+  struct State {
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> doneChunks{0};
+    std::atomic<bool> hasFailed{false};
+    std::mutex mutex;
+    std::condition_variable condition;
+    std::exception_ptr error;
+  };
+  // parallelFor(..) only waits for the chunks, not for the helpers - a helper that is still queued (e.g. because all workers
+  // are busy in an outer parallelFor(..)) just finds no chunks left once it runs, so nesting parallelFor(..) on a worker
+  // can't deadlock. Such a late helper may outlive this call, so the state is shared, and `task` is only touched while
+  // chunks are left. This only holds because `work` never throws - errors are collected and rethrown at the end.
+  auto state = std::make_shared<State>();
+
+  auto work = [&task, count, chunkSize, chunksCount](State& state) noexcept {
+    while (true) {
+      size_t chunk = state.nextChunk.fetch_add(1, std::memory_order_relaxed);
+      if (chunk >= chunksCount) {
+        return;
+      }
+      if (!state.hasFailed.load(std::memory_order_relaxed)) {
+        size_t begin = chunk * chunkSize;
+        try {
+          task(begin, std::min(begin + chunkSize, count));
+        } catch (...) {
+          std::unique_lock lock(state.mutex);
+          if (state.error == nullptr) {
+            state.error = std::current_exception();
+          }
+          // Skip all remaining chunks
+          state.hasFailed.store(true, std::memory_order_relaxed);
+        }
+      }
+      if (state.doneChunks.fetch_add(1, std::memory_order_acq_rel) + 1 == chunksCount) {
+        std::unique_lock lock(state.mutex);
+        state.condition.notify_one();
+      }
+    }
+  };
+
+  for (size_t i = 0; i < helpersCount; i++) {
+    run([state, work]() { work(*state); });
+  }
+
+  work(*state);
+
+  std::unique_lock lock(state->mutex);
+  state->condition.wait(lock, [&]() { return state->doneChunks.load(std::memory_order_acquire) == chunksCount; });
+  if (state->error != nullptr) {
+    std::rethrow_exception(state->error);
+  }
+}
+
+} // namespace vision
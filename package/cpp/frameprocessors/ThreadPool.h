@@ -0,0 +1,77 @@
+//
+//  ThreadPool.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <vector>
+
+namespace vision {
+
+/**
+ * A fixed-size pool of worker Threads for CPU-bound native work on Frames (e.g. `Frame.resize(..)`).
+ */
+class ThreadPool {
+public:
+  /**
+   * Wraps the whole life of a worker Thread, e.g. to attach it to a VM once instead of for every task.
+   * It has to call `runWorker` exactly once, on the Thread it was called on.
+   */
+  using WorkerScope = std::function<void(const std::function<void()>& runWorker)>;
+
+  explicit ThreadPool(size_t threadsCount, WorkerScope workerScope = nullptr);
+  ~ThreadPool();
+
+  /**
+   * Get the shared ThreadPool, which uses one Thread less than there are CPU cores (the calling Thread also works).
+   */
+  static const std::shared_ptr<ThreadPool>& getSharedInstance();
+  /**
+   * Sets the WorkerScope of the shared ThreadPool's Threads. This has to be called before the shared ThreadPool is first
+   * used, so platforms call this when the library is loaded.
+   */
+  static void setSharedWorkerScope(WorkerScope workerScope);
+
+public:
+  /**
+   * Runs the given task on one of the worker Threads. `task` must not throw.
+   */
+  void run(std::function<void()> task);
+
+  /**
+   * Splits `[0, count)` into chunks of `chunkSize` and runs `task(begin, end)` for every chunk, in parallel on the
+   * worker Threads and the calling Thread. Chunks are handed out dynamically, so uneven chunks are balanced.
+   * This blocks until all chunks are done. If `task` throws, the remaining chunks are skipped and the first exception is
+   * rethrown on the calling Thread once all running chunks are done.
+   * This may also be called from a task running on this pool (e.g. a parallel Plugin that resizes), the calling Thread then
+   * does all chunks the busy workers don't pick up.
+   */
+  void parallelFor(size_t count, size_t chunkSize, const std::function<void(size_t begin, size_t end)>& task);
+
+  size_t getThreadsCount() const {
+    return _threads.size();
+  }
+
+private:
+  void workerLoop();
+
+private:
+  std::vector<std::thread> _threads;
+  std::queue<std::function<void()>> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _isStopped = false;
+};
+
+} // namespace vision
@@ -0,0 +1,136 @@
+//
+//  TypedArray.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "TypedArray.h"
+#include "ArrayBufferPool.h"
+#include "RuntimeCache.h"
+
+#include <array>
+#include <cstring>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace vision {
+
+static constexpr size_t kTypedArrayKindsCount = 9;
+
+namespace {
+  /**
+   * The TypedArray constructors of a Runtime, looked up once instead of on every conversion.
+   */
+  struct TypedArrayConstructors {
+    explicit TypedArrayConstructors(jsi::Runtime& runtime)
+        : constructors{
+              runtime.global().getPropertyAsFunction(runtime, "Int8Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Uint8Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Uint8ClampedArray"),
+              runtime.global().getPropertyAsFunction(runtime, "Int16Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Uint16Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Int32Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Uint32Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Float32Array"),
+              runtime.global().getPropertyAsFunction(runtime, "Float64Array"),
+          },
+          bytesPerElement(jsi::PropNameID::forAscii(runtime, "BYTES_PER_ELEMENT")),
+          buffer(jsi::PropNameID::forAscii(runtime, "buffer")), byteOffset(jsi::PropNameID::forAscii(runtime, "byteOffset")),
+          length(jsi::PropNameID::forAscii(runtime, "length")) {}
+
+    // In the order of TypedArrayKind
+    std::array<jsi::Function, kTypedArrayKindsCount> constructors;
+    jsi::PropNameID bytesPerElement;
+    jsi::PropNameID buffer;
+    jsi::PropNameID byteOffset;
+    jsi::PropNameID length;
+
+    const jsi::Function& get(TypedArrayKind kind) const {
+      return constructors[static_cast<size_t>(kind)];
+    }
+  };
+} // namespace
+
+size_t getBytesPerElement(TypedArrayKind kind) {
+  switch (kind) {
+    case TypedArrayKind::Int8:
+    case TypedArrayKind::Uint8:
+    case TypedArrayKind::Uint8Clamped:
+      return 1;
+    case TypedArrayKind::Int16:
+    case TypedArrayKind::Uint16:
+      return 2;
+    case TypedArrayKind::Int32:
+    case TypedArrayKind::Uint32:
+    case TypedArrayKind::Float32:
+      return 4;
+    case TypedArrayKind::Float64:
+      return 8;
+  }
+  throw std::runtime_error("Invalid TypedArrayKind!");
+}
+
+namespace TypedArrays {
+
+  jsi::Object create(jsi::Runtime& runtime, TypedArrayKind kind, const jsi::ArrayBuffer& arrayBuffer, size_t byteOffset, size_t length) {
+    const auto& constructors = RuntimeCache<TypedArrayConstructors>::get(runtime);
+    jsi::Value arguments[] = {jsi::Value(runtime, arrayBuffer), jsi::Value(static_cast<double>(byteOffset)),
+                              jsi::Value(static_cast<double>(length))};
+    return constructors.get(kind).callAsConstructor(runtime, arguments, 3).getObject(runtime);
+  }
+
+  jsi::Object createCopy(jsi::Runtime& runtime, TypedArrayKind kind, const void* data, size_t length) {
+    size_t byteLength = length * getBytesPerElement(kind);
+    auto buffer = ArrayBufferPool::getSharedInstance()->acquire(byteLength);
+    if (byteLength > 0) {
+      std::memcpy(buffer->data(), data, byteLength);
+    }
+    jsi::ArrayBuffer arrayBuffer(runtime, std::move(buffer));
+    return create(runtime, kind, arrayBuffer, 0, length);
+  }
+
+  std::optional<TypedArrayView> getView(jsi::Runtime& runtime, const jsi::Object& object) {
+    const auto& constructors = RuntimeCache<TypedArrayConstructors>::get(runtime);
+    // Only TypedArrays inherit BYTES_PER_ELEMENT, so plain objects are rejected with a single lookup.
+    jsi::Value bytesPerElement = object.getProperty(runtime, constructors.bytesPerElement);
+    if (!bytesPerElement.isNumber()) {
+      return std::nullopt;
+    }
+
+    std::optional<TypedArrayKind> kind;
+    for (size_t i = 0; i < kTypedArrayKindsCount; i++) {
+      auto candidate = static_cast<TypedArrayKind>(i);
+      if (getBytesPerElement(candidate) == static_cast<size_t>(bytesPerElement.getNumber()) &&
+          object.instanceOf(runtime, constructors.get(candidate))) {
+        kind = candidate;
+        break;
+      }
+    }
+    if (!kind.has_value()) {
+      // e.g. BigInt64Array, which has no native counterpart
+      return std::nullopt;
+    }
+
+    jsi::Value buffer = object.getProperty(runtime, constructors.buffer);
+    if (!buffer.isObject() || !buffer.getObject(runtime).isArrayBuffer(runtime)) {
+      return std::nullopt;
+    }
+    jsi::ArrayBuffer arrayBuffer = buffer.getObject(runtime).getArrayBuffer(runtime);
+    size_t byteOffset = static_cast<size_t>(object.getProperty(runtime, constructors.byteOffset).asNumber());
+    size_t length = static_cast<size_t>(object.getProperty(runtime, constructors.length).asNumber());
+
+    TypedArrayView view;
+    view.kind = *kind;
+    view.data = arrayBuffer.data(runtime) + byteOffset;
+    view.length = length;
+    view.byteLength = length * getBytesPerElement(*kind);
+    return view;
+  }
+
+} // namespace TypedArrays
+
+} // namespace vision
@@ -0,0 +1,64 @@
+//
+//  TypedArray.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace vision {
+
+using namespace facebook;
+
+enum class TypedArrayKind {
+  Int8,
+  Uint8,
+  Uint8Clamped,
+  Int16,
+  Uint16,
+  Int32,
+  Uint32,
+  Float32,
+  Float64,
+};
+
+size_t getBytesPerElement(TypedArrayKind kind);
+
+/**
+ * The memory of a JS TypedArray. Only valid as long as the TypedArray is alive and its buffer is not detached.
+ */
+struct TypedArrayView {
+  TypedArrayKind kind;
+  uint8_t* data;
+  size_t length;
+  size_t byteLength;
+};
+
+namespace TypedArrays {
+
+  /**
+   * Creates a new JS TypedArray of the given kind which views `length` elements of `arrayBuffer`, starting at `byteOffset`.
+   */
+  jsi::Object create(jsi::Runtime& runtime, TypedArrayKind kind, const jsi::ArrayBuffer& arrayBuffer, size_t byteOffset, size_t length);
+
+  /**
+   * Creates a new JS TypedArray of the given kind with a copy of `length` elements of `data`, backed by the `ArrayBufferPool`.
+   */
+  jsi::Object createCopy(jsi::Runtime& runtime, TypedArrayKind kind, const void* data, size_t length);
+
+  /**
+   * Gets the memory of the given object if it is a TypedArray (e.g. a `Float32Array`), otherwise returns `std::nullopt`.
+   */
+  std::optional<TypedArrayView> getView(jsi::Runtime& runtime, const jsi::Object& object);
+
+} // namespace TypedArrays
+
+} // namespace vision
@@ -0,0 +1,164 @@
+//
+//  TypedResult.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "TypedResult.h"
+#include "ArrayBufferPool.h"
+#include "TypedArray.h"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vision {
+
+// TypedArray views have to start at a multiple of their element size, 16 bytes also keeps every field SIMD-aligned.
+static constexpr size_t kFieldAlignment = 16;
+
+static TypedArrayKind getTypedArrayKind(TypedResultDataType dataType) {
+  switch (dataType) {
+    case TypedResultDataType::Float32:
+      return TypedArrayKind::Float32;
+    case TypedResultDataType::Int32:
+      return TypedArrayKind::Int32;
+  }
+  throw std::runtime_error("Invalid TypedResultDataType!");
+}
+
+size_t getBytesPerElement(TypedResultDataType dataType) {
+  switch (dataType) {
+    case TypedResultDataType::Float32:
+    case TypedResultDataType::Int32:
+      return 4;
+  }
+  throw std::runtime_error("Invalid TypedResultDataType!");
+}
+
+TypedResultSchema::TypedResultSchema(size_t capacity) : _capacity(capacity), _byteSize(0), _isInUse(false) {}
+
+void TypedResultSchema::addArray(const std::string& name, TypedResultDataType dataType, size_t componentsCount) {
+  if (componentsCount == 0) {
+    throw std::runtime_error("TypedResultSchema: Array field \"" + name + "\" needs at least one component!");
+  }
+  addField(name, dataType, false, componentsCount);
+}
+
+void TypedResultSchema::addTensor(const std::string& name, TypedResultDataType dataType, const std::vector<size_t>& shape) {
+  if (shape.empty()) {
+    throw std::runtime_error("TypedResultSchema: Tensor field \"" + name + "\" needs at least one dimension!");
+  }
+  size_t elementsCount = 1;
+  for (size_t dimension : shape) {
+    elementsCount *= dimension;
+  }
+  if (elementsCount == 0) {
+    throw std::runtime_error("TypedResultSchema: Tensor field \"" + name + "\" cannot have an empty dimension!");
+  }
+  addField(name, dataType, true, elementsCount);
+}
+
+void TypedResultSchema::addField(const std::string& name, TypedResultDataType dataType, bool isTensor, size_t elementsCount) {
+  if (_isInUse.load(std::memory_order_acquire)) {
+    throw std::runtime_error("TypedResultSchema: Cannot add field \"" + name + "\" after a TypedResult has been created!");
+  }
+  if (name == "count") {
+    throw std::runtime_error("TypedResultSchema: \"count\" is a reserved field name!");
+  }
+  for (const auto& field : _fields) {
+    if (field.name == name) {
+      throw std::runtime_error("TypedResultSchema: Field \"" + name + "\" already exists!");
+    }
+  }
+
+  size_t rowsCount = isTensor ? 1 : _capacity;
+  TypedResultField field;
+  field.name = name;
+  field.dataType = dataType;
+  field.isTensor = isTensor;
+  field.elementsCount = elementsCount;
+  field.byteOffset = (_byteSize + kFieldAlignment - 1) / kFieldAlignment * kFieldAlignment;
+  field.byteSize = rowsCount * elementsCount * getBytesPerElement(dataType);
+  _byteSize = field.byteOffset + field.byteSize;
+  _fields.push_back(std::move(field));
+}
+
+size_t TypedResultSchema::getFieldIndex(const std::string& name) const {
+  for (size_t i = 0; i < _fields.size(); i++) {
+    if (_fields[i].name == name) {
+      return i;
+    }
+  }
+  throw std::runtime_error("TypedResultSchema: There is no field named \"" + name + "\"!");
+}
+
+const TypedResultField& TypedResultSchema::getField(size_t index) const {
+  if (index >= _fields.size()) {
+    throw std::runtime_error("TypedResultSchema: Field index " + std::to_string(index) + " is out of bounds!");
+  }
+  return _fields[index];
+}
+
+const std::vector<TypedResultField>& TypedResultSchema::getFields() const {
+  return _fields;
+}
+
+size_t TypedResultSchema::getCapacity() const {
+  return _capacity;
+}
+
+size_t TypedResultSchema::getByteSize() const {
+  return _byteSize;
+}
+
+TypedResult::TypedResult(std::shared_ptr<TypedResultSchema> schema) : _schema(std::move(schema)), _count(0) {
+  if (_schema->_fields.empty()) {
+    throw std::runtime_error("TypedResultSchema: Cannot create a TypedResult from a schema without fields!");
+  }
+  _schema->_isInUse.store(true, std::memory_order_release);
+  _buffer = ArrayBufferPool::getSharedInstance()->acquire(_schema->getByteSize());
+}
+
+const TypedResultSchema& TypedResult::getSchema() const {
+  return *_schema;
+}
+
+uint8_t* TypedResult::getFieldData(size_t index) {
+  return _buffer->data() + _schema->getField(index).byteOffset;
+}
+
+size_t TypedResult::getFieldByteSize(size_t index) const {
+  return _schema->getField(index).byteSize;
+}
+
+void TypedResult::setCount(size_t count) {
+  if (count > _schema->getCapacity()) {
+    throw std::runtime_error("TypedResult: Count " + std::to_string(count) + " exceeds the capacity of the schema (" +
+                             std::to_string(_schema->getCapacity()) + ")!");
+  }
+  _count = count;
+}
+
+size_t TypedResult::getCount() const {
+  return _count;
+}
+
+jsi::Value TypedResult::toJSIValue(jsi::Runtime& runtime) const {
+  // All fields are views into one ArrayBuffer, which keeps the pooled buffer alive.
+  jsi::ArrayBuffer arrayBuffer(runtime, _buffer);
+  jsi::Object result(runtime);
+  result.setProperty(runtime, "count", jsi::Value(static_cast<double>(_count)));
+  for (const auto& field : _schema->getFields()) {
+    size_t length = field.isTensor ? field.elementsCount : _count * field.elementsCount;
+    jsi::Object view = TypedArrays::create(runtime, getTypedArrayKind(field.dataType), arrayBuffer, field.byteOffset, length);
+    result.setProperty(runtime, field.name.c_str(), std::move(view));
+  }
+  return result;
+}
+
+} // namespace vision
@@ -0,0 +1,132 @@
+//
+//  TypedResult.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "MutableRawBuffer.h"
+#include <jsi/jsi.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vision {
+
+using namespace facebook;
+
+enum class TypedResultDataType {
+  // 32-bit IEEE 754 float, a `Float32Array` in JS
+  Float32,
+  // 32-bit signed integer, an `Int32Array` in JS
+  Int32,
+};
+
+size_t getBytesPerElement(TypedResultDataType dataType);
+
+struct TypedResultField {
+  std::string name;
+  TypedResultDataType dataType;
+  // Array fields hold `elementsCount` values per row and are truncated to the count of the result in JS,
+  // Tensor fields always hold `elementsCount` values (the product of their shape).
+  bool isTensor;
+  size_t elementsCount;
+  // Offset of this field in the buffer of a `TypedResult`, always 16-byte aligned
+  size_t byteOffset;
+  size_t byteSize;
+};
+
+/**
+ * Describes the layout of the values a Frame Processor Plugin returns as a `TypedResult`.
+ *
+ * A schema is a struct-of-arrays: every Array field holds up to `capacity` rows of a fixed number of
+ * components (e.g. `x` and `y` of a landmark), and every Tensor field holds a fixed number of values.
+ * All fields live in one contiguous buffer, so a result becomes one `ArrayBuffer` with a TypedArray view per field in JS.
+ *
+ * Schemas are created once (e.g. in the Plugin's initializer), fields can no longer be added once a result has been created.
+ */
+class TypedResultSchema {
+public:
+  explicit TypedResultSchema(size_t capacity);
+
+public:
+  /**
+   * Adds an Array field with `componentsCount` values per row.
+   */
+  void addArray(const std::string& name, TypedResultDataType dataType, size_t componentsCount);
+  /**
+   * Adds a Tensor field with the given fixed shape.
+   */
+  void addTensor(const std::string& name, TypedResultDataType dataType, const std::vector<size_t>& shape);
+
+  /**
+   * Get the index of the field with the given name. Throws a `std::runtime_error` if there is no such field.
+   */
+  size_t getFieldIndex(const std::string& name) const;
+  const TypedResultField& getField(size_t index) const;
+  const std::vector<TypedResultField>& getFields() const;
+
+  /**
+   * The maximum number of rows of Array fields.
+   */
+  size_t getCapacity() const;
+  /**
+   * The size of the buffer of one result in bytes.
+   */
+  size_t getByteSize() const;
+
+private:
+  friend class TypedResult;
+  void addField(const std::string& name, TypedResultDataType dataType, bool isTensor, size_t elementsCount);
+
+private:
+  size_t _capacity;
+  size_t _byteSize;
+  std::vector<TypedResultField> _fields;
+  std::atomic<bool> _isInUse;
+};
+
+/**
+ * A preallocated, pooled buffer laid out by a `TypedResultSchema`.
+ *
+ * Plugins write their values directly into the field buffers and set the number of valid rows with `setCount(..)`.
+ * Returning it from a Plugin converts it to `{ count, [field]: Float32Array | Int32Array }` with one `ArrayBuffer` -
+ * no value is boxed or converted individually. The contents of a new result are undefined.
+ *
+ * Create a new result for every call, as the returned TypedArrays share their memory with the result.
+ */
+class TypedResult {
+public:
+  explicit TypedResult(std::shared_ptr<TypedResultSchema> schema);
+
+public:
+  const TypedResultSchema& getSchema() const;
+
+  uint8_t* getFieldData(size_t index);
+  size_t getFieldByteSize(size_t index) const;
+
+  /**
+   * Sets the number of valid rows of all Array fields. Throws a `std::runtime_error` if it exceeds the capacity.
+   */
+  void setCount(size_t count);
+  size_t getCount() const;
+
+  /**
+   * Creates the JS representation of this result. The TypedArrays keep the underlying buffer alive.
+   */
+  jsi::Value toJSIValue(jsi::Runtime& runtime) const;
+
+private:
+  std::shared_ptr<TypedResultSchema> _schema;
+  std::shared_ptr<MutableRawBuffer> _buffer;
+  size_t _count;
+};
+
+} // namespace vision
@@ -0,0 +1,101 @@
+//
+//  VisionCameraStats.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "VisionCameraStats.h"
+#include "ArrayBufferPool.h"
+#include "FrameProcessorTimings.h"
+#include "FrameScope.h"
+#include "FrameSequenceTracker.h"
+#include "PluginOptionsCache.h"
+
+#include <jsi/jsi.h>
+
+namespace vision {
+
+namespace VisionCameraStats {
+
+  using namespace facebook;
+
+  static jsi::Object getArrayBufferPoolStats(jsi::Runtime& runtime) {
+    auto stats = ArrayBufferPool::getSharedInstance()->getStats();
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "hits", static_cast<double>(stats.hits));
+    result.setProperty(runtime, "misses", static_cast<double>(stats.misses));
+    result.setProperty(runtime, "bytesResident", static_cast<double>(stats.bytesResident));
+    result.setProperty(runtime, "bytesInUse", static_cast<double>(stats.bytesInUse));
+    return result;
+  }
+
+  static jsi::Object getPluginOptionsStats(jsi::Runtime& runtime) {
+    auto stats = PluginOptions::getStats();
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "conversions", static_cast<double>(stats.conversions));
+    result.setProperty(runtime, "cacheHits", static_cast<double>(stats.cacheHits));
+    return result;
+  }
+
+  static jsi::Object getHistogramStats(jsi::Runtime& runtime, LatencyHistogram& histogram, bool reset) {
+    auto snapshot = histogram.getSnapshot(reset);
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "count", static_cast<double>(snapshot.count));
+    result.setProperty(runtime, "mean", snapshot.mean);
+    result.setProperty(runtime, "p50", snapshot.p50);
+    result.setProperty(runtime, "p90", snapshot.p90);
+    result.setProperty(runtime, "p99", snapshot.p99);
+    result.setProperty(runtime, "max", snapshot.max);
+    return result;
+  }
+
+  static jsi::Object getTimingStats(jsi::Runtime& runtime, bool reset) {
+    jsi::Object plugins(runtime);
+    for (const auto& [name, histogram] : FrameProcessorTimings::getPluginHistograms()) {
+      plugins.setProperty(runtime, name.c_str(), getHistogramStats(runtime, *histogram, reset));
+    }
+
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "frameProcessor", getHistogramStats(runtime, FrameProcessorTimings::getFrameProcessorHistogram(), reset));
+    result.setProperty(runtime, "argumentConversion",
+                       getHistogramStats(runtime, FrameProcessorTimings::getArgumentConversionHistogram(), reset));
+    result.setProperty(runtime, "resultConversion",
+                       getHistogramStats(runtime, FrameProcessorTimings::getResultConversionHistogram(), reset));
+    result.setProperty(runtime, "plugins", plugins);
+    return result;
+  }
+
+  static jsi::Object getFrameStats(jsi::Runtime& runtime, bool reset) {
+    auto stats = FrameSequenceTracker::getStats();
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "processed", static_cast<double>(stats.processed));
+    result.setProperty(runtime, "dropped", static_cast<double>(stats.dropped));
+    result.setProperty(runtime, "queueingDelay", getHistogramStats(runtime, FrameSequenceTracker::getQueueingDelayHistogram(), reset));
+    return result;
+  }
+
+  static jsi::Object getMemoryStats(jsi::Runtime& runtime, bool reset) {
+    auto stats = FrameScope::getStats(reset);
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "arenaPeakBytes", static_cast<double>(stats.arenaPeakBytes));
+    result.setProperty(runtime, "arenaReservedBytes", static_cast<double>(stats.arenaReservedBytes));
+    result.setProperty(runtime, "heapGrowthPeakBytes", static_cast<double>(stats.heapGrowthPeakBytes));
+    result.setProperty(runtime, "heapGrowthMeanBytes", stats.heapGrowthMeanBytes);
+    return result;
+  }
+
+  jsi::Object getStats(jsi::Runtime& runtime, bool resetTimings) {
+    jsi::Object result(runtime);
+    result.setProperty(runtime, "arrayBufferPool", getArrayBufferPoolStats(runtime));
+    result.setProperty(runtime, "pluginOptions", getPluginOptionsStats(runtime));
+    result.setProperty(runtime, "timings", getTimingStats(runtime, resetTimings));
+    result.setProperty(runtime, "frames", getFrameStats(runtime, resetTimings));
+    result.setProperty(runtime, "memory", getMemoryStats(runtime, resetTimings));
+    return result;
+  }
+
+} // namespace VisionCameraStats
+
+} // namespace vision
@@ -0,0 +1,28 @@
+//
+//  VisionCameraStats.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include <jsi/jsi.h>
+
+namespace vision {
+
+namespace VisionCameraStats {
+
+  using namespace facebook;
+
+  /**
+   * Collects runtime statistics of the Frame Processor subsystems into a JS object.
+   * This is exposed to JS as `VisionCameraProxy.getStats()`.
+   * If `resetTimings` is true, the timing histograms are cleared after reading them.
+   */
+  jsi::Object getStats(jsi::Runtime& runtime, bool resetTimings);
+
+} // namespace VisionCameraStats
+
+} // namespace vision
@@ -0,0 +1,45 @@
+//
+//  TestRuntime.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "TestRuntime.h"
+
+#include "FrameHostObject.h"
+#include "FrameScope.h"
+
+#include <hermes/hermes.h>
+
+#include <memory>
+#include <string>
+
+namespace vision {
+
+std::unique_ptr<jsi::Runtime> TestRuntime::create() {
+  return facebook::hermes::makeHermesRuntime();
+}
+
+jsi::Value TestRuntime::evaluate(jsi::Runtime& runtime, const std::string& source) {
+  // Wrapped in parentheses so function and object literals are evaluated as expressions
+  return runtime.evaluateJavaScript(std::make_shared<jsi::StringBuffer>("(" + source + ")"), "test.js");
+}
+
+TestFrameProcessor::TestFrameProcessor(jsi::Runtime& runtime, const std::string& source)
+    : _runtime(runtime), _function(TestRuntime::evaluate(runtime, source).asObject(runtime).asFunction(runtime)) {}
+
+void TestFrameProcessor::call(const std::shared_ptr<NativeFrame>& frame) {
+  FrameScope scope(_runtime);
+  auto frameHostObject = std::make_shared<FrameHostObject>(frame);
+  try {
+    _function.call(_runtime, jsi::Object::createFromHostObject(_runtime, frameHostObject));
+  } catch (...) {
+    frameHostObject->onFrameProcessorFinished();
+    throw;
+  }
+  frameHostObject->onFrameProcessorFinished();
+}
+
+} // namespace vision
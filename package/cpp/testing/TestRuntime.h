@@ -0,0 +1,58 @@
+//
+//  TestRuntime.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#include "NativeFrame.h"
+#include <jsi/jsi.h>
+
+#include <memory>
+#include <string>
+
+namespace vision {
+
+using namespace facebook;
+
+/**
+ * A headless Hermes runtime for running the Frame Processor core in tests and benchmarks, without a Camera or an app.
+ */
+class TestRuntime {
+public:
+  /**
+   * Creates a new Hermes runtime.
+   */
+  static std::unique_ptr<jsi::Runtime> create();
+
+  /**
+   * Evaluates the given JS source and returns its completion value, e.g. `"(frame) => frame.width"` returns the function.
+   */
+  static jsi::Value evaluate(jsi::Runtime& runtime, const std::string& source);
+};
+
+/**
+ * A JS Frame Processor that is called the same way the Android and iOS Frame Processors call it.
+ */
+class TestFrameProcessor {
+public:
+  /**
+   * Evaluates `source`, which has to be a function that takes a Frame.
+   */
+  TestFrameProcessor(jsi::Runtime& runtime, const std::string& source);
+
+  /**
+   * Calls the Frame Processor with the given Frame inside a `FrameScope`, and releases the Frame once it returned.
+   * The result is discarded, just like on the platforms - store it in `globalThis` to inspect it.
+   */
+  void call(const std::shared_ptr<NativeFrame>& frame);
+
+private:
+  jsi::Runtime& _runtime;
+  jsi::Function _function;
+};
+
+} // namespace vision
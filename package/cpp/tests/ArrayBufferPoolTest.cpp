@@ -0,0 +1,52 @@
+//
+//  ArrayBufferPoolTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ArrayBufferPool.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace vision;
+
+// Large enough that three of them exceed the cap of the free buffers together, while two fit
+static constexpr size_t kLargeSize = ArrayBufferPool::kMaxFreeBytes / 2 - 4096 * 64;
+
+TEST(ArrayBufferPoolTest, ReusesReleasedBuffers) {
+  auto& pool = ArrayBufferPool::getSharedInstance();
+  pool->acquire(kLargeSize + 1);
+
+  auto before = pool->getStats();
+  auto buffer = pool->acquire(kLargeSize + 1);
+  auto after = pool->getStats();
+  EXPECT_EQ(after.hits, before.hits + 1);
+  EXPECT_EQ(buffer->size(), kLargeSize + 1);
+}
+
+TEST(ArrayBufferPoolTest, FreesLeastRecentlyReleasedBuffersAboveTheCap) {
+  auto& pool = ArrayBufferPool::getSharedInstance();
+  // Three different buckets, released from oldest to newest
+  auto oldest = pool->acquire(kLargeSize + 4096 * 10);
+  auto middle = pool->acquire(kLargeSize + 4096 * 20);
+  auto newest = pool->acquire(kLargeSize + 4096 * 30);
+  oldest = nullptr;
+  middle = nullptr;
+  newest = nullptr;
+
+  auto stats = pool->getStats();
+  EXPECT_LE(stats.bytesResident - stats.bytesInUse, ArrayBufferPool::kMaxFreeBytes);
+
+  auto before = pool->getStats();
+  auto newestAgain = pool->acquire(kLargeSize + 4096 * 30);
+  auto middleAgain = pool->acquire(kLargeSize + 4096 * 20);
+  EXPECT_EQ(pool->getStats().hits, before.hits + 2);
+
+  before = pool->getStats();
+  auto oldestAgain = pool->acquire(kLargeSize + 4096 * 10);
+  EXPECT_EQ(pool->getStats().misses, before.misses + 1);
+}
@@ -0,0 +1,85 @@
+//
+//  FrameMethodCacheTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+#include "TestRuntime.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace vision;
+
+static constexpr const char* kCountMethods = R"((frame) => {
+  globalThis.methods ??= new Set()
+  globalThis.accesses = (globalThis.accesses ?? 0) + 1
+  for (const name of ['incrementRefCount', 'decrementRefCount', 'toString', 'toArrayBuffer', 'getPlanes', 'resize']) {
+    // Accessed twice, so a new Function per access would show up as well
+    globalThis.methods.add(frame[name])
+    globalThis.methods.add(frame[name])
+  }
+})";
+
+TEST(FrameMethodCacheTest, CreatesEveryMethodOncePerRuntime) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, kCountMethods);
+  for (uint32_t i = 0; i < 100; i++) {
+    frameProcessor.call(SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::YUV, i));
+  }
+
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "globalThis.accesses").asNumber(), 100);
+  // The number of Functions stays the same no matter how many Frames or accesses there were
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "globalThis.methods.size").asNumber(), 6);
+}
+
+TEST(FrameMethodCacheTest, KeepsSeparateMethodsPerRuntime) {
+  auto first = TestRuntime::create();
+  auto second = TestRuntime::create();
+  TestFrameProcessor firstFrameProcessor(*first, kCountMethods);
+  TestFrameProcessor secondFrameProcessor(*second, kCountMethods);
+  auto frame = SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::RGB, 0);
+  for (int i = 0; i < 10; i++) {
+    firstFrameProcessor.call(frame);
+    secondFrameProcessor.call(frame);
+  }
+
+  EXPECT_EQ(TestRuntime::evaluate(*first, "globalThis.methods.size").asNumber(), 6);
+  EXPECT_EQ(TestRuntime::evaluate(*second, "globalThis.methods.size").asNumber(), 6);
+}
+
+TEST(FrameMethodCacheTest, ResolvesFrameThroughThis) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    globalThis.description = frame.toString()
+    const toString = frame.toString
+    try {
+      toString()
+      globalThis.error = ''
+    } catch (e) {
+      globalThis.error = e.message
+    }
+  })");
+  frameProcessor.call(SyntheticFrame::createTestPattern(32, 16, FramePixelFormat::RGB, 0));
+
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "globalThis.description").asString(*runtime).utf8(*runtime), "32 x 16 rgb Frame");
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "globalThis.error").asString(*runtime).utf8(*runtime),
+            "Frame.toString() has to be called on a Frame!");
+}
+
+TEST(FrameMethodCacheTest, DoesNotAddEnumerableGlobals) {
+  auto runtime = TestRuntime::create();
+  TestFrameProcessor frameProcessor(*runtime, kCountMethods);
+  frameProcessor.call(SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::YUV, 0));
+
+  // The caches are torn down with the Runtime through a property in `global`, which must stay hidden from JS
+  auto keys = TestRuntime::evaluate(*runtime, "Object.keys(globalThis).filter((key) => key.startsWith('__visionCamera')).length");
+  EXPECT_EQ(keys.asNumber(), 0);
+  auto names = TestRuntime::evaluate(*runtime, "Object.getOwnPropertyNames(globalThis).filter((key) => key.startsWith('__visionCamera'))");
+  EXPECT_GT(names.asObject(*runtime).asArray(*runtime).size(*runtime), 0u);
+}
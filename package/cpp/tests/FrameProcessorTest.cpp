@@ -0,0 +1,180 @@
+//
+//  FrameProcessorTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+#include "TestRuntime.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace vision;
+
+namespace {
+
+// Wraps a SyntheticFrame and counts how many locks on its memory are currently held.
+class LockCountingFrame : public NativeFrame {
+public:
+  explicit LockCountingFrame(std::shared_ptr<NativeFrame> frame) : _frame(std::move(frame)) {}
+
+  const FrameMetadata& getMetadata() const override {
+    return _frame->getMetadata();
+  }
+  bool getIsValid() const override {
+    return _frame->getIsValid();
+  }
+  std::vector<FramePlane> lockPlanes(std::shared_ptr<void>& lock) override {
+    auto planes = _frame->lockPlanes(lock);
+    lock = countLock(std::move(lock));
+    return planes;
+  }
+  uint8_t* lockBuffer(std::shared_ptr<void>& lock, size_t& size) override {
+    uint8_t* data = _frame->lockBuffer(lock, size);
+    lock = countLock(std::move(lock));
+    return data;
+  }
+  NativeBuffer getNativeBuffer() override {
+    return _frame->getNativeBuffer();
+  }
+  PixelLayout getPackedLayout() const override {
+    return _frame->getPackedLayout();
+  }
+  bool getIsFullRange() const override {
+    return _frame->getIsFullRange();
+  }
+  void retain() override {}
+  void release() override {}
+
+  int getLocksCount() const {
+    return *_locksCount;
+  }
+
+private:
+  std::shared_ptr<void> countLock(std::shared_ptr<void> lock) {
+    auto locksCount = _locksCount;
+    (*locksCount)++;
+    return std::shared_ptr<void>(lock.get(), [lock, locksCount](void*) mutable {
+      lock = nullptr;
+      (*locksCount)--;
+    });
+  }
+
+private:
+  std::shared_ptr<NativeFrame> _frame;
+  std::shared_ptr<std::atomic<int>> _locksCount = std::make_shared<std::atomic<int>>(0);
+};
+
+} // namespace
+
+class FrameProcessorTest : public ::testing::Test {
+protected:
+  double getGlobalNumber(const char* name) {
+    return runtime->global().getProperty(*runtime, name).asNumber();
+  }
+
+protected:
+  std::unique_ptr<jsi::Runtime> runtime = TestRuntime::create();
+};
+
+TEST_F(FrameProcessorTest, ReadsFrameMetadata) {
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    globalThis.width = frame.width
+    globalThis.height = frame.height
+    globalThis.planesCount = frame.planesCount
+    globalThis.isYuv = frame.pixelFormat === 'yuv'
+    globalThis.description = frame.toString()
+  })");
+  frameProcessor.call(SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0));
+
+  EXPECT_EQ(getGlobalNumber("width"), 64);
+  EXPECT_EQ(getGlobalNumber("height"), 48);
+  EXPECT_EQ(getGlobalNumber("planesCount"), 2);
+  EXPECT_TRUE(runtime->global().getProperty(*runtime, "isYuv").getBool());
+  EXPECT_EQ(runtime->global().getProperty(*runtime, "description").asString(*runtime).utf8(*runtime), "64 x 48 yuv Frame");
+}
+
+TEST_F(FrameProcessorTest, CopiesFrameIntoArrayBuffer) {
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    const buffer = frame.toArrayBuffer()
+    globalThis.byteLength = buffer.byteLength
+    globalThis.firstPixel = new Uint8Array(buffer)[1]
+  })");
+  frameProcessor.call(SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0));
+
+  // 64 bytes per row, 48 rows of Y and 24 rows of interleaved CbCr
+  EXPECT_EQ(getGlobalNumber("byteLength"), 64 * 48 + 64 * 24);
+  EXPECT_EQ(getGlobalNumber("firstPixel"), 1);
+}
+
+TEST_F(FrameProcessorTest, InvalidatesFrameOnceFrameProcessorReturned) {
+  TestFrameProcessor frameProcessor(*runtime, "(frame) => { globalThis.lastFrame = frame }");
+  frameProcessor.call(SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::RGB, 0));
+
+  EXPECT_FALSE(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.isValid").getBool());
+  EXPECT_THROW(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.width"), jsi::JSError);
+}
+
+TEST_F(FrameProcessorTest, KeepsFrameAliveWhileRefCountIsIncremented) {
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    frame.incrementRefCount()
+    globalThis.lastFrame = frame
+  })");
+  frameProcessor.call(SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::RGB, 0));
+
+  EXPECT_TRUE(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.isValid").getBool());
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.width").asNumber(), 16);
+  TestRuntime::evaluate(*runtime, "globalThis.lastFrame.decrementRefCount()");
+  EXPECT_FALSE(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.isValid").getBool());
+}
+
+TEST_F(FrameProcessorTest, ReadsZeroCopyBuffersAfterFrameIsClosed) {
+  auto frame = std::make_shared<LockCountingFrame>(SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0));
+  {
+    TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+      globalThis.lastFrame = frame
+      globalThis.buffer = frame.toArrayBuffer({ copy: false })
+      globalThis.planes = frame.getPlanes({ copy: false })
+    })");
+    frameProcessor.call(frame);
+  }
+
+  // The Frame is closed, but the views own their lock and keep the memory mapped until they get garbage-collected.
+  EXPECT_FALSE(TestRuntime::evaluate(*runtime, "globalThis.lastFrame.isValid").getBool());
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "new Uint8Array(globalThis.buffer)[1]").asNumber(), 1);
+  EXPECT_EQ(TestRuntime::evaluate(*runtime, "new Uint8Array(globalThis.planes[0].buffer)[1]").asNumber(), 1);
+  EXPECT_EQ(frame->getLocksCount(), 2);
+
+  // Destroying the Runtime collects the ArrayBuffers, which unlocks the memory
+  runtime = nullptr;
+  EXPECT_EQ(frame->getLocksCount(), 0);
+}
+
+TEST_F(FrameProcessorTest, ProcessesSyntheticFrameSource) {
+  TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+    globalThis.count = (globalThis.count ?? 0) + 1
+    globalThis.lastTimestamp = frame.timestamp
+  })");
+  SyntheticFrameSource source({SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0),
+                               SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 1)});
+  SyntheticFrameSource::Options options;
+  options.targetFps = 0;
+  options.framesCount = 100;
+
+  double lastTimestamp = 0;
+  auto result = source.run(options, [&](const std::shared_ptr<NativeFrame>& frame) {
+    frameProcessor.call(frame);
+    lastTimestamp = frame->getMetadata().timestamp;
+  });
+
+  EXPECT_EQ(result.delivered, 100u);
+  EXPECT_EQ(getGlobalNumber("count"), 100);
+  EXPECT_EQ(getGlobalNumber("lastTimestamp"), lastTimestamp);
+}
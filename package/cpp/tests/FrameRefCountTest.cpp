@@ -0,0 +1,139 @@
+//
+//  FrameRefCountTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameRefCount.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace vision;
+
+namespace {
+
+// Counts the platform retain/release calls of one FrameRefCount.
+struct PlatformFrame {
+  std::atomic<int> retains{0};
+  std::atomic<int> releases{0};
+  std::atomic<bool> releasedBeforeRetained{false};
+
+  std::unique_ptr<FrameRefCount> createRefCount() {
+    return std::make_unique<FrameRefCount>([this]() { retains++; },
+                                           [this]() {
+                                             if (retains.load() == 0) {
+                                               releasedBeforeRetained = true;
+                                             }
+                                             releases++;
+                                           });
+  }
+};
+
+constexpr int kIterations = 500;
+constexpr int kThreadsCount = 4;
+
+// Runs `work(threadIndex)` on kThreadsCount Threads and `onCallingThread()` at the same time.
+template <typename Work, typename OnCallingThread> void runConcurrently(Work&& work, OnCallingThread&& onCallingThread) {
+  std::atomic<int> ready{0};
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreadsCount; i++) {
+    threads.emplace_back([&, i]() {
+      ready++;
+      while (ready.load() <= kThreadsCount) {
+        std::this_thread::yield();
+      }
+      work(i);
+    });
+  }
+  while (ready.load() < kThreadsCount) {
+    std::this_thread::yield();
+  }
+  ready++;
+  onCallingThread();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+TEST(FrameRefCountTest, ClosesWithoutPlatformRetainIfNobodyElseHoldsIt) {
+  PlatformFrame platform;
+  auto refCount = platform.createRefCount();
+  EXPECT_TRUE(refCount->isValid());
+  refCount->releaseBorrowedReference();
+  EXPECT_FALSE(refCount->isValid());
+  EXPECT_FALSE(refCount->retain());
+  EXPECT_EQ(platform.retains.load(), 0);
+  EXPECT_EQ(platform.releases.load(), 0);
+}
+
+TEST(FrameRefCountTest, ReleasesPlatformFrameWhenJSReleasesConcurrently) {
+  for (int iteration = 0; iteration < kIterations; iteration++) {
+    PlatformFrame platform;
+    auto refCount = platform.createRefCount();
+    // Every Thread holds one reference (e.g. a `runAsync` call), and releases it while the Frame Processor returns.
+    for (int i = 0; i < kThreadsCount; i++) {
+      ASSERT_TRUE(refCount->retain());
+    }
+    runConcurrently([&](int) { refCount->release(); }, [&]() { refCount->releaseBorrowedReference(); });
+
+    ASSERT_FALSE(refCount->isValid());
+    ASSERT_LE(platform.retains.load(), 1);
+    ASSERT_EQ(platform.releases.load(), platform.retains.load());
+    ASSERT_FALSE(platform.releasedBeforeRetained.load());
+  }
+}
+
+TEST(FrameRefCountTest, NeverResurrectsReleasedFrame) {
+  for (int iteration = 0; iteration < kIterations; iteration++) {
+    PlatformFrame platform;
+    auto refCount = platform.createRefCount();
+    std::atomic<int> held{0};
+    // JS keeps incrementing and decrementing while the Frame Processor returns, so some retains race with the close.
+    runConcurrently(
+        [&](int) {
+          for (int i = 0; i < 50; i++) {
+            if (refCount->retain()) {
+              held++;
+              refCount->release();
+              held--;
+            }
+          }
+        },
+        [&]() { refCount->releaseBorrowedReference(); });
+
+    ASSERT_EQ(held.load(), 0);
+    ASSERT_FALSE(refCount->isValid());
+    ASSERT_FALSE(refCount->retain());
+    ASSERT_EQ(platform.releases.load(), platform.retains.load());
+    ASSERT_FALSE(platform.releasedBeforeRetained.load());
+  }
+}
+
+TEST(FrameRefCountTest, ReleasesPlatformFrameOnceWhenOverReleased) {
+  for (int iteration = 0; iteration < kIterations; iteration++) {
+    PlatformFrame platform;
+    auto refCount = platform.createRefCount();
+    ASSERT_TRUE(refCount->retain());
+    // Buggy JS decrements a lot more often than it incremented
+    runConcurrently(
+        [&](int) {
+          for (int i = 0; i < 10; i++) {
+            refCount->release();
+          }
+        },
+        [&]() { refCount->releaseBorrowedReference(); });
+
+    ASSERT_FALSE(refCount->isValid());
+    ASSERT_LE(platform.releases.load(), 1);
+    ASSERT_EQ(platform.releases.load(), platform.retains.load());
+  }
+}
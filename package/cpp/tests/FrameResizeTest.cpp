@@ -0,0 +1,72 @@
+//
+//  FrameResizeTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+#include "TestRuntime.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace vision;
+
+class FrameResizeTest : public ::testing::Test {
+protected:
+  // Calls `frame.resize(options)` on a 64 x 48 Frame, and returns the error message, or "" if it succeeded.
+  std::string resize(const std::string& options) {
+    TestFrameProcessor frameProcessor(*runtime, R"((frame) => {
+      try {
+        globalThis.byteLength = frame.resize()" + options + R"().byteLength
+        globalThis.error = ''
+      } catch (e) {
+        globalThis.error = e.message
+      }
+    })");
+    frameProcessor.call(SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0));
+    return runtime->global().getProperty(*runtime, "error").asString(*runtime).utf8(*runtime);
+  }
+
+protected:
+  std::unique_ptr<jsi::Runtime> runtime = TestRuntime::create();
+};
+
+TEST_F(FrameResizeTest, ResizesToRequestedSize) {
+  EXPECT_EQ(resize("{ width: 32, height: 24, pixelFormat: 'rgba', dataType: 'float32' }"), "");
+  EXPECT_EQ(runtime->global().getProperty(*runtime, "byteLength").asNumber(), 32 * 24 * 4 * sizeof(float));
+}
+
+TEST_F(FrameResizeTest, RejectsNonIntegerSizes) {
+  EXPECT_NE(resize("{ width: NaN, height: 24 }").find("`width` has to be an integer"), std::string::npos);
+  EXPECT_NE(resize("{ width: 32, height: Infinity }").find("`height` has to be an integer"), std::string::npos);
+  EXPECT_NE(resize("{ width: -Infinity, height: 24 }").find("`width` has to be an integer"), std::string::npos);
+  EXPECT_NE(resize("{ width: 32.5, height: 24 }").find("`width` has to be an integer"), std::string::npos);
+}
+
+TEST_F(FrameResizeTest, RejectsOutOfRangeSizes) {
+  EXPECT_NE(resize("{ width: 0, height: 24 }").find("`width` has to be between"), std::string::npos);
+  EXPECT_NE(resize("{ width: 1e6, height: 1e6 }").find("`width` has to be between"), std::string::npos);
+  EXPECT_NE(resize("{ width: 32, height: 2 ** 40 }").find("`height` has to be between"), std::string::npos);
+  // Both axes are in range, but the buffer would be 8192 * 8192 * 4 * 4 bytes
+  EXPECT_NE(resize("{ width: 8192, height: 8192, pixelFormat: 'rgba', dataType: 'float32' }").find("more than the maximum"),
+            std::string::npos);
+}
+
+TEST_F(FrameResizeTest, RejectsCropOutsideOfFrame) {
+  EXPECT_EQ(resize("{ width: 16, height: 16, crop: { x: 16, y: 16, width: 48, height: 32 } }"), "");
+  EXPECT_NE(resize("{ width: 16, height: 16, crop: { x: 17, y: 0, width: 48, height: 32 } }").find("`crop`"), std::string::npos);
+  EXPECT_NE(resize("{ width: 16, height: 16, crop: { x: 0, y: 0, width: 0, height: 32 } }").find("`crop`"), std::string::npos);
+  EXPECT_NE(resize("{ width: 16, height: 16, crop: { x: 2 ** 31, y: 0, width: 2 ** 31, height: 32 } }").find("`crop.x`"),
+            std::string::npos);
+  EXPECT_NE(resize("{ width: 16, height: 16, crop: { x: NaN, y: 0, width: 16, height: 16 } }").find("`crop.x`"), std::string::npos);
+}
+
+TEST_F(FrameResizeTest, RejectsNonFiniteNormalization) {
+  EXPECT_NE(resize("{ width: 16, height: 16, dataType: 'float32', mean: NaN }").find("`mean`"), std::string::npos);
+  EXPECT_NE(resize("{ width: 16, height: 16, dataType: 'float32', std: [1, Infinity, 1] }").find("`std`"), std::string::npos);
+}
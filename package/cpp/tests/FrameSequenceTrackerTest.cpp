@@ -0,0 +1,89 @@
+//
+//  FrameSequenceTrackerTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "FrameSequenceTracker.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace vision;
+
+namespace {
+
+  constexpr int64_t kFrameIntervalNs = 33'333'333;
+  constexpr int64_t kStartTimestampNs = 1'000'000'000;
+
+  // The counters are shared by all trackers, so every test only looks at what it added.
+  uint64_t getDroppedCount() {
+    return FrameSequenceTracker::getStats().dropped;
+  }
+
+} // namespace
+
+TEST(FrameSequenceTrackerTest, CountsGapsInASteadySequence) {
+  FrameSequenceTracker tracker;
+  uint64_t droppedBefore = getDroppedCount();
+  int64_t timestamp = kStartTimestampNs;
+  for (int i = 0; i < 10; i++) {
+    tracker.onFrame(timestamp, -1, 0);
+    timestamp += kFrameIntervalNs;
+  }
+  // Two Frames are missing
+  timestamp += 2 * kFrameIntervalNs;
+  tracker.onFrame(timestamp, -1, 0);
+  EXPECT_EQ(getDroppedCount() - droppedBefore, 2u);
+}
+
+TEST(FrameSequenceTrackerTest, CountsSteadyOneInNDelivery) {
+  // The Camera runs at 30 FPS, but only every third Frame reaches the Frame Processor.
+  constexpr int kFramesCount = 20;
+  FrameSequenceTracker tracker;
+  uint64_t droppedBefore = getDroppedCount();
+  int64_t timestamp = kStartTimestampNs;
+  for (int i = 0; i < kFramesCount; i++) {
+    tracker.onFrame(timestamp, -1, kFrameIntervalNs);
+    timestamp += 3 * kFrameIntervalNs;
+  }
+  EXPECT_EQ(getDroppedCount() - droppedBefore, 2u * (kFramesCount - 1));
+}
+
+TEST(FrameSequenceTrackerTest, CountsDropInFirstInterval) {
+  FrameSequenceTracker tracker;
+  uint64_t droppedBefore = getDroppedCount();
+  tracker.onFrame(kStartTimestampNs, -1, kFrameIntervalNs);
+  tracker.onFrame(kStartTimestampNs + 2 * kFrameIntervalNs, -1, kFrameIntervalNs);
+  tracker.onFrame(kStartTimestampNs + 3 * kFrameIntervalNs, -1, kFrameIntervalNs);
+  EXPECT_EQ(getDroppedCount() - droppedBefore, 1u);
+}
+
+TEST(FrameSequenceTrackerTest, FollowsFrameRateWithinConfiguredRange) {
+  // A 15-30 FPS range lets auto-exposure halve the frame rate without dropping any Frame.
+  FrameSequenceTracker tracker;
+  uint64_t droppedBefore = getDroppedCount();
+  int64_t timestamp = kStartTimestampNs;
+  int64_t intervalNs = kFrameIntervalNs;
+  for (int i = 0; i < 100; i++) {
+    tracker.onFrame(timestamp, -1, 2 * kFrameIntervalNs);
+    timestamp += intervalNs;
+    intervalNs = std::min(intervalNs + kFrameIntervalNs / 50, 2 * kFrameIntervalNs);
+  }
+  EXPECT_EQ(getDroppedCount() - droppedBefore, 0u);
+}
+
+TEST(FrameSequenceTrackerTest, StartsNewSequenceAfterLongGap) {
+  FrameSequenceTracker tracker;
+  uint64_t droppedBefore = getDroppedCount();
+  tracker.onFrame(kStartTimestampNs, -1, kFrameIntervalNs);
+  tracker.onFrame(kStartTimestampNs + kFrameIntervalNs, -1, kFrameIntervalNs);
+  // The Camera restarted two seconds later
+  tracker.onFrame(kStartTimestampNs + 2'000'000'000, -1, kFrameIntervalNs);
+  tracker.onFrame(kStartTimestampNs + 2'000'000'000 + kFrameIntervalNs, -1, kFrameIntervalNs);
+  EXPECT_EQ(getDroppedCount() - droppedBefore, 0u);
+}
@@ -0,0 +1,45 @@
+//
+//  LatencyHistogramTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "LatencyHistogram.h"
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace vision;
+
+TEST(LatencyHistogramTest, MergesDurationsOfAllThreads) {
+  constexpr int kThreadsCount = 8;
+  constexpr int kValuesPerThread = 1000;
+  LatencyHistogram histogram;
+
+  std::vector<std::thread> threads;
+  for (int thread = 0; thread < kThreadsCount; thread++) {
+    // Every Thread records a different duration, so each shard holds other values
+    threads.emplace_back([&histogram, thread]() {
+      for (int i = 0; i < kValuesPerThread; i++) {
+        histogram.record(static_cast<uint64_t>(thread + 1) * 1000);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto snapshot = histogram.getSnapshot(true);
+  EXPECT_EQ(snapshot.count, static_cast<uint64_t>(kThreadsCount * kValuesPerThread));
+  EXPECT_DOUBLE_EQ(snapshot.mean, 4.5);
+  EXPECT_DOUBLE_EQ(snapshot.max, 8.0);
+  // Percentiles are bucket middles, which are at most 12.5% off
+  EXPECT_NEAR(snapshot.p50, 4.0, 0.5);
+
+  // Resetting clears every shard
+  EXPECT_EQ(histogram.getSnapshot().count, 0u);
+}
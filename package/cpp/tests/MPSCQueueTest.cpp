@@ -0,0 +1,141 @@
+//
+//  MPSCQueueTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "BatchedJobQueue.h"
+#include "MPSCQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace vision;
+
+TEST(MPSCQueueTest, PopsInPushOrder) {
+  MPSCQueue<std::unique_ptr<int>> queue;
+  EXPECT_FALSE(queue.pop().has_value());
+  for (int i = 0; i < 100; i++) {
+    queue.push(std::make_unique<int>(i));
+  }
+  for (int i = 0; i < 100; i++) {
+    auto value = queue.pop();
+    ASSERT_TRUE(value.has_value());
+    EXPECT_EQ(**value, i);
+  }
+  EXPECT_FALSE(queue.pop().has_value());
+
+  // The queue keeps working after it ran empty, which recycles the stub node
+  queue.push(std::make_unique<int>(42));
+  EXPECT_EQ(*queue.pop().value(), 42);
+  EXPECT_FALSE(queue.pop().has_value());
+}
+
+TEST(MPSCQueueTest, DestroysRemainingValues) {
+  auto value = std::make_shared<int>(0);
+  {
+    MPSCQueue<std::shared_ptr<int>> queue;
+    for (int i = 0; i < 10; i++) {
+      queue.push(std::shared_ptr<int>(value));
+    }
+    EXPECT_EQ(value.use_count(), 11);
+  }
+  EXPECT_EQ(value.use_count(), 1);
+}
+
+TEST(MPSCQueueTest, DeliversEveryValueOnceFromConcurrentProducers) {
+  constexpr int kProducersCount = 4;
+  constexpr int kValuesPerProducer = 20000;
+  MPSCQueue<std::pair<int, int>> queue;
+  std::atomic<bool> start{false};
+
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < kProducersCount; producer++) {
+    producers.emplace_back([&, producer]() {
+      while (!start.load()) {
+        std::this_thread::yield();
+      }
+      for (int i = 0; i < kValuesPerProducer; i++) {
+        queue.push({producer, i});
+      }
+    });
+  }
+
+  // The consumer runs while the producers push, and pop() may come back empty while a push is in progress.
+  start = true;
+  std::vector<int> nextValue(kProducersCount, 0);
+  int received = 0;
+  while (received < kProducersCount * kValuesPerProducer) {
+    auto value = queue.pop();
+    if (!value.has_value()) {
+      std::this_thread::yield();
+      continue;
+    }
+    auto [producer, i] = *value;
+    // Values of one producer arrive in the order they were pushed, without gaps or duplicates
+    if (producer < 0 || producer >= kProducersCount || i != nextValue[producer]) {
+      ADD_FAILURE() << "Received value " << i << " of producer " << producer << " out of order!";
+      break;
+    }
+    nextValue[producer]++;
+    received++;
+  }
+  for (auto& thread : producers) {
+    thread.join();
+  }
+
+  EXPECT_FALSE(queue.pop().has_value());
+  for (int count : nextValue) {
+    EXPECT_EQ(count, kValuesPerProducer);
+  }
+}
+
+TEST(MPSCQueueTest, BatchedJobQueueNeverStrandsAJob) {
+  constexpr int kProducersCount = 4;
+  constexpr int kJobsPerProducer = 20000;
+  std::atomic<int> pendingTriggers{0};
+  BatchedJobQueue queue([&]() { pendingTriggers.fetch_add(1); });
+  std::atomic<int> ranJobs{0};
+  std::atomic<int> finishedProducers{0};
+  std::atomic<bool> start{false};
+
+  std::vector<std::thread> producers;
+  for (int producer = 0; producer < kProducersCount; producer++) {
+    producers.emplace_back([&]() {
+      while (!start.load()) {
+        std::this_thread::yield();
+      }
+      for (int i = 0; i < kJobsPerProducer; i++) {
+        queue.dispatchAsync([&]() { ranJobs.fetch_add(1, std::memory_order_relaxed); });
+      }
+      finishedProducers.fetch_add(1);
+    });
+  }
+
+  // The consumer only runs jobs when a trigger was scheduled, like the Frame Processor Thread.
+  auto runPendingTriggers = [&]() {
+    while (pendingTriggers.load() > 0) {
+      pendingTriggers.fetch_sub(1);
+      queue.trigger();
+    }
+  };
+  start = true;
+  while (finishedProducers.load() < kProducersCount) {
+    runPendingTriggers();
+    std::this_thread::yield();
+  }
+  for (auto& thread : producers) {
+    thread.join();
+  }
+
+  // Once every producer returned, the triggers they scheduled alone must drain every job.
+  runPendingTriggers();
+  EXPECT_EQ(ranJobs.load(), kProducersCount * kJobsPerProducer);
+}
@@ -0,0 +1,80 @@
+//
+//  NativeStateTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "NativeState.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace vision;
+
+TEST(NativeStateTest, CreatesSlotsWhenFrameProcessorIsSet) {
+  NativeStateRegistry registry;
+  EXPECT_EQ(registry.get("tracker"), nullptr);
+
+  registry.setFrameProcessorStates(1, {"tracker"});
+  auto state = registry.get("tracker");
+  ASSERT_NE(state, nullptr);
+  EXPECT_EQ(state->getName(), "tracker");
+  EXPECT_FALSE(state->hasValue());
+}
+
+TEST(NativeStateTest, ReleasesSlotsWhenFrameProcessorIsRemoved) {
+  NativeStateRegistry registry;
+  registry.setFrameProcessorStates(1, {"tracker"});
+  std::weak_ptr<int> value = registry.get("tracker")->getOrCreate<int>(42);
+
+  registry.removeFrameProcessorStates(1);
+  EXPECT_EQ(registry.get("tracker"), nullptr);
+  EXPECT_TRUE(value.expired());
+}
+
+TEST(NativeStateTest, KeepsSlotsUsedByReplacingFrameProcessor) {
+  NativeStateRegistry registry;
+  registry.setFrameProcessorStates(1, {"tracker", "flow"});
+  registry.get("tracker")->getOrCreate<int>(42);
+  std::weak_ptr<int> flow = registry.get("flow")->getOrCreate<int>(7);
+
+  // The new Frame Processor still uses the tracker, but no longer the optical flow
+  registry.setFrameProcessorStates(1, {"tracker"});
+  ASSERT_NE(registry.get("tracker"), nullptr);
+  EXPECT_EQ(*registry.get("tracker")->get<int>(), 42);
+  EXPECT_EQ(registry.get("flow"), nullptr);
+  EXPECT_TRUE(flow.expired());
+}
+
+TEST(NativeStateTest, SharesSlotsBetweenViews) {
+  NativeStateRegistry registry;
+  registry.setFrameProcessorStates(1, {"tracker"});
+  registry.setFrameProcessorStates(2, {"tracker"});
+  registry.get("tracker")->getOrCreate<int>(42);
+
+  registry.removeFrameProcessorStates(1);
+  ASSERT_NE(registry.get("tracker"), nullptr);
+  EXPECT_EQ(*registry.get("tracker")->get<int>(), 42);
+
+  registry.removeFrameProcessorStates(2);
+  EXPECT_EQ(registry.get("tracker"), nullptr);
+}
+
+TEST(NativeStateTest, PluginsKeepReleasedSlotsAlive) {
+  NativeStateRegistry registry;
+  registry.setFrameProcessorStates(1, {"tracker"});
+  auto state = registry.get("tracker");
+  state->getOrCreate<int>(42);
+
+  registry.removeFrameProcessorStates(1);
+  EXPECT_TRUE(state->hasValue());
+  EXPECT_EQ(registry.get("tracker"), state);
+
+  // Once the Plugin lets go, a new Frame Processor gets a fresh slot
+  state = nullptr;
+  registry.setFrameProcessorStates(1, {"tracker"});
+  EXPECT_FALSE(registry.get("tracker")->hasValue());
+}
@@ -0,0 +1,166 @@
+//
+//  PixelConversionTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "PixelConversion.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace vision;
+
+namespace {
+
+// The SIMD kernels only run on 16 pixel blocks, so strips narrower than that are always converted by the scalar kernel.
+constexpr int32_t kScalarStripWidth = 8;
+
+constexpr PixelLayout kLayouts[] = {PixelLayout::RGB, PixelLayout::BGR, PixelLayout::RGBA, PixelLayout::BGRA, PixelLayout::Gray};
+
+std::string getLayoutName(PixelLayout layout) {
+  switch (layout) {
+    case PixelLayout::RGB:
+      return "rgb";
+    case PixelLayout::BGR:
+      return "bgr";
+    case PixelLayout::RGBA:
+      return "rgba";
+    case PixelLayout::BGRA:
+      return "bgra";
+    case PixelLayout::Gray:
+      return "gray";
+  }
+  return "unknown";
+}
+
+// Random bytes, half of them from the extremes so the saturating paths are always covered.
+std::vector<uint8_t> createRandomBytes(size_t size, uint32_t seed) {
+  const uint8_t extremes[] = {0, 1, 16, 127, 128, 235, 240, 254, 255};
+  std::mt19937 random(seed);
+  std::uniform_int_distribution<int> distribution(0, 255);
+  std::vector<uint8_t> bytes(size);
+  for (auto& byte : bytes) {
+    int value = distribution(random);
+    byte = value % 2 == 0 ? static_cast<uint8_t>(distribution(random)) : extremes[value % 9];
+  }
+  return bytes;
+}
+
+// A random YUV 4:2:0 image with an odd width, so every row has a SIMD body and a scalar tail.
+struct YUVImage {
+  int32_t width = 83;
+  int32_t height = 11;
+  int32_t yBytesPerRow = 96;
+  int32_t uvBytesPerRow = 96;
+  std::vector<uint8_t> y;
+  std::vector<uint8_t> uv;
+
+  explicit YUVImage(uint32_t seed)
+      : y(createRandomBytes(yBytesPerRow * height, seed)), uv(createRandomBytes(uvBytesPerRow * height, seed + 1)) {}
+
+  // `uvPixelStride` 1 is planar (I420), 2 is semi-planar (NV12, or NV21 if `isVFirst`)
+  YUVImageView getView(int32_t uvPixelStride, bool isVFirst, bool isFullRange) const {
+    const uint8_t* u = uv.data();
+    const uint8_t* v = uvPixelStride == 1 ? uv.data() + uvBytesPerRow / 2 : uv.data() + 1;
+    if (isVFirst) {
+      std::swap(u, v);
+    }
+    return {width, height, y.data(), yBytesPerRow, u, v, uvBytesPerRow, uvPixelStride, isFullRange};
+  }
+};
+
+// Converts the image in narrow strips, which only uses the scalar kernel.
+std::vector<uint8_t> convertScalar(const YUVImageView& view, PixelLayout layout, size_t bytesPerRow) {
+  std::vector<uint8_t> result(bytesPerRow * view.height);
+  for (int32_t x = 0; x < view.width; x += kScalarStripWidth) {
+    YUVImageView strip = view;
+    strip.width = std::min(kScalarStripWidth, view.width - x);
+    strip.y += x;
+    strip.u += (x / 2) * view.uvPixelStride;
+    strip.v += (x / 2) * view.uvPixelStride;
+    PixelConversion::convert(strip, result.data() + x * getBytesPerPixel(layout), bytesPerRow, layout);
+  }
+  return result;
+}
+
+std::vector<uint8_t> convertScalar(const PackedImageView& view, PixelLayout layout, size_t bytesPerRow) {
+  std::vector<uint8_t> result(bytesPerRow * view.height);
+  for (int32_t x = 0; x < view.width; x += kScalarStripWidth) {
+    PackedImageView strip = view;
+    strip.width = std::min(kScalarStripWidth, view.width - x);
+    strip.data += x * 4;
+    PixelConversion::convert(strip, result.data() + x * getBytesPerPixel(layout), bytesPerRow, layout);
+  }
+  return result;
+}
+
+} // namespace
+
+TEST(PixelConversionTest, ConvertsYUVBitExactToScalar) {
+  SCOPED_TRACE(std::string("Kernel: ") + PixelConversion::getKernelName());
+  YUVImage image(42);
+  for (int32_t uvPixelStride : {1, 2}) {
+    for (bool isVFirst : {false, true}) {
+      for (bool isFullRange : {false, true}) {
+        for (PixelLayout layout : kLayouts) {
+          SCOPED_TRACE("uvPixelStride: " + std::to_string(uvPixelStride) + ", isVFirst: " + std::to_string(isVFirst) +
+                       ", isFullRange: " + std::to_string(isFullRange) + ", layout: " + getLayoutName(layout));
+          YUVImageView view = image.getView(uvPixelStride, isVFirst, isFullRange);
+          size_t bytesPerRow = view.width * getBytesPerPixel(layout);
+          std::vector<uint8_t> result(bytesPerRow * view.height);
+          PixelConversion::convert(view, result.data(), bytesPerRow, layout);
+
+          ASSERT_EQ(result, convertScalar(view, layout, bytesPerRow));
+        }
+      }
+    }
+  }
+}
+
+TEST(PixelConversionTest, ConvertsPackedBitExactToScalar) {
+  SCOPED_TRACE(std::string("Kernel: ") + PixelConversion::getKernelName());
+  const int32_t width = 83;
+  const int32_t height = 7;
+  const int32_t bytesPerRow = 340;
+  std::vector<uint8_t> pixels = createRandomBytes(bytesPerRow * height, 7);
+  for (PixelLayout sourceLayout : {PixelLayout::RGBA, PixelLayout::BGRA}) {
+    for (PixelLayout layout : kLayouts) {
+      SCOPED_TRACE("source: " + getLayoutName(sourceLayout) + ", layout: " + getLayoutName(layout));
+      PackedImageView view{width, height, pixels.data(), bytesPerRow, sourceLayout};
+      size_t destinationBytesPerRow = width * getBytesPerPixel(layout);
+      std::vector<uint8_t> result(destinationBytesPerRow * height);
+      PixelConversion::convert(view, result.data(), destinationBytesPerRow, layout);
+
+      ASSERT_EQ(result, convertScalar(view, layout, destinationBytesPerRow));
+    }
+  }
+}
+
+TEST(PixelConversionTest, ConvertsKnownColors) {
+  // Black, white, gray and red, twice so the SIMD kernel converts all 16 pixels
+  const uint8_t y[16] = {16, 16, 235, 235, 128, 128, 76, 76, 16, 16, 235, 235, 128, 128, 76, 76};
+  const uint8_t u[8] = {128, 128, 128, 85, 128, 128, 128, 85};
+  const uint8_t v[8] = {128, 128, 128, 255, 128, 128, 128, 255};
+  uint8_t rgb[16 * 3];
+
+  YUVImageView videoRange{16, 1, y, 16, u, v, 8, 1, false};
+  PixelConversion::convert(videoRange, rgb, sizeof(rgb), PixelLayout::RGB);
+  EXPECT_EQ(rgb[0], 0);
+  EXPECT_EQ(rgb[2 * 3], 255);
+  EXPECT_EQ(rgb[4 * 3 + 1], 131);
+
+  YUVImageView fullRange{16, 1, y, 16, u, v, 8, 1, true};
+  PixelConversion::convert(fullRange, rgb, sizeof(rgb), PixelLayout::RGB);
+  EXPECT_EQ(rgb[4 * 3 + 1], 128);
+  EXPECT_GE(rgb[6 * 3 + 0], 250);
+  EXPECT_LE(rgb[6 * 3 + 1], 5);
+  EXPECT_LE(rgb[6 * 3 + 2], 5);
+}
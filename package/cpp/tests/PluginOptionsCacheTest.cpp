@@ -0,0 +1,75 @@
+//
+//  PluginOptionsCacheTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "PluginOptionsCache.h"
+#include "TestRuntime.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+using namespace vision;
+
+class PluginOptionsCacheTest : public ::testing::Test {
+protected:
+  // Stands in for the platform conversion, and counts how often it ran
+  std::shared_ptr<std::string> get(const char* source) {
+    jsi::Object options = TestRuntime::evaluate(*runtime, source).asObject(*runtime);
+    return cache.get(*runtime, options, [this](jsi::Runtime& runtime, const jsi::Object& options) {
+      conversions++;
+      return std::make_shared<std::string>(options.getProperty(runtime, "model").asString(runtime).utf8(runtime));
+    });
+  }
+
+protected:
+  std::unique_ptr<jsi::Runtime> runtime = TestRuntime::create();
+  PluginOptionsCache<std::shared_ptr<std::string>> cache;
+  int conversions = 0;
+};
+
+TEST_F(PluginOptionsCacheTest, ConvertsEqualOptionsOnce) {
+  EXPECT_EQ(*get("({ model: 'fast', threshold: 0.5 })"), "fast");
+  EXPECT_EQ(*get("({ model: 'fast', threshold: 0.5 })"), "fast");
+  EXPECT_EQ(conversions, 1);
+
+  EXPECT_EQ(*get("({ model: 'accurate', threshold: 0.5 })"), "accurate");
+  EXPECT_EQ(conversions, 2);
+}
+
+TEST_F(PluginOptionsCacheTest, MarksConvertedOptionsObject) {
+  TestRuntime::evaluate(*runtime, "globalThis.options = { model: 'fast', threshold: 0.5 }");
+  auto first = get("globalThis.options");
+  jsi::Object options = TestRuntime::evaluate(*runtime, "globalThis.options").asObject(*runtime);
+  EXPECT_TRUE(options.hasNativeState<PluginOptions::ConvertedOptions<std::shared_ptr<std::string>>>(*runtime));
+
+  // The same object hits the marker and gets the very same native value back
+  EXPECT_EQ(get("globalThis.options"), first);
+  EXPECT_EQ(conversions, 1);
+}
+
+TEST_F(PluginOptionsCacheTest, DetectsInPlaceChangesOfMarkedOptions) {
+  TestRuntime::evaluate(*runtime, "globalThis.options = { model: 'fast' }");
+  EXPECT_EQ(*get("globalThis.options"), "fast");
+
+  TestRuntime::evaluate(*runtime, "globalThis.options.model = 'accurate'");
+  EXPECT_EQ(*get("globalThis.options"), "accurate");
+  EXPECT_EQ(conversions, 2);
+}
+
+TEST_F(PluginOptionsCacheTest, DoesNotMarkNestedOptions) {
+  TestRuntime::evaluate(*runtime, "globalThis.options = { model: 'fast', size: { width: 192, height: 192 } }");
+  get("globalThis.options");
+  jsi::Object options = TestRuntime::evaluate(*runtime, "globalThis.options").asObject(*runtime);
+  EXPECT_FALSE(options.hasNativeState(*runtime));
+
+  // Nested changes are still caught by the fingerprint
+  TestRuntime::evaluate(*runtime, "globalThis.options.size.width = 320");
+  get("globalThis.options");
+  EXPECT_EQ(conversions, 2);
+}
@@ -0,0 +1,99 @@
+//
+//  SyntheticFrameSourceTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "SyntheticFrameSource.h"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace vision;
+
+TEST(SyntheticFrameSourceTest, CreatesYuvTestPattern) {
+  auto frame = SyntheticFrame::createTestPattern(100, 50, FramePixelFormat::YUV, 0);
+  std::shared_ptr<void> lock;
+  auto planes = frame->lockPlanes(lock);
+
+  ASSERT_EQ(planes.size(), 2u);
+  EXPECT_EQ(planes[0].width, 100);
+  EXPECT_EQ(planes[0].height, 50);
+  EXPECT_EQ(planes[0].bytesPerRow % 64, 0);
+  EXPECT_EQ(planes[1].width, 50);
+  EXPECT_EQ(planes[1].height, 25);
+  EXPECT_EQ(planes[1].pixelStride, 2);
+  EXPECT_EQ(frame->getMetadata().planesCount, 2);
+  EXPECT_EQ(frame->getMetadata().pixelFormat, FramePixelFormat::YUV);
+}
+
+TEST(SyntheticFrameSourceTest, CreatesRgbTestPattern) {
+  auto frame = SyntheticFrame::createTestPattern(33, 7, FramePixelFormat::RGB, 1);
+  std::shared_ptr<void> lock;
+  size_t size = 0;
+  uint8_t* buffer = frame->lockBuffer(lock, size);
+
+  ASSERT_NE(buffer, nullptr);
+  EXPECT_EQ(size, static_cast<size_t>(frame->getMetadata().bytesPerRow) * 7);
+  // Alpha is always opaque
+  EXPECT_EQ(buffer[3], 255);
+}
+
+TEST(SyntheticFrameSourceTest, RejectsPlanesOutsideOfData) {
+  auto data = std::make_shared<const std::vector<uint8_t>>(100);
+  FrameMetadata metadata{10, 10, 10, 1, 0, FrameOrientation::Portrait, FramePixelFormat::YUV, false};
+  EXPECT_THROW(SyntheticFrame(metadata, data, {SyntheticFrame::PlaneLayout{0, 10, 11, 10, 1}}), std::invalid_argument);
+  EXPECT_THROW(SyntheticFrameSource({}), std::invalid_argument);
+}
+
+TEST(SyntheticFrameSourceTest, DeliversAllFramesAtMaxThroughput) {
+  SyntheticFrameSource source({SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 0),
+                               SyntheticFrame::createTestPattern(64, 48, FramePixelFormat::YUV, 1)});
+  SyntheticFrameSource::Options options;
+  options.targetFps = 0;
+  options.framesCount = 50;
+
+  std::vector<double> timestamps;
+  auto result = source.run(options, [&](const std::shared_ptr<NativeFrame>& frame) {
+    // Every delivered Frame gets its own capture timestamp
+    timestamps.push_back(frame->getMetadata().timestamp);
+  });
+
+  EXPECT_EQ(result.delivered, 50u);
+  EXPECT_EQ(result.dropped, 0u);
+  EXPECT_EQ(result.processingTime.count, 50u);
+  ASSERT_EQ(timestamps.size(), 50u);
+  for (size_t i = 1; i < timestamps.size(); i++) {
+    EXPECT_GT(timestamps[i], timestamps[i - 1]);
+  }
+}
+
+TEST(SyntheticFrameSourceTest, DropsFramesWhileConsumerIsBusy) {
+  SyntheticFrameSource source({SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::RGB, 0)});
+  SyntheticFrameSource::Options options;
+  options.targetFps = 200;
+  options.framesCount = 20;
+
+  auto result = source.run(options, [](const std::shared_ptr<NativeFrame>&) {
+    // Takes about 3 Frame intervals per Frame
+    std::this_thread::sleep_for(std::chrono::milliseconds(15));
+  });
+
+  EXPECT_EQ(result.delivered + result.dropped, 20u);
+  EXPECT_GT(result.dropped, 0u);
+}
+
+TEST(SyntheticFrameSourceTest, AbortsIfConsumerThrows) {
+  SyntheticFrameSource source({SyntheticFrame::createTestPattern(16, 16, FramePixelFormat::RGB, 0)});
+  SyntheticFrameSource::Options options;
+  options.targetFps = 0;
+  EXPECT_THROW(source.run(options, [](const std::shared_ptr<NativeFrame>&) { throw std::runtime_error("Consumer failed!"); }),
+               std::runtime_error);
+}
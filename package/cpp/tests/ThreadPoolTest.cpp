@@ -0,0 +1,126 @@
+//
+//  ThreadPoolTest.cpp
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#include "ThreadPool.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace vision;
+
+TEST(ThreadPoolTest, RunsEveryIndexExactlyOnce) {
+  ThreadPool pool(3);
+  std::vector<std::atomic<int>> visits(1000);
+  pool.parallelFor(visits.size(), 7, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      visits[i]++;
+    }
+  });
+  for (const auto& count : visits) {
+    EXPECT_EQ(count.load(), 1);
+  }
+}
+
+TEST(ThreadPoolTest, RethrowsExceptionFromCallingThread) {
+  ThreadPool pool(3);
+  const auto callingThread = std::this_thread::get_id();
+  std::atomic<size_t> chunksDone{0};
+  EXPECT_THROW(pool.parallelFor(64, 1,
+                                [&](size_t, size_t) {
+                                  std::this_thread::sleep_for(std::chrono::microseconds(100));
+                                  if (std::this_thread::get_id() == callingThread) {
+                                    throw std::runtime_error("Failed on the calling Thread!");
+                                  }
+                                  chunksDone++;
+                                }),
+               std::runtime_error);
+  // All helpers are done once parallelFor(..) returned
+  size_t chunksDoneAfterReturn = chunksDone.load();
+  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+  EXPECT_EQ(chunksDone.load(), chunksDoneAfterReturn);
+}
+
+TEST(ThreadPoolTest, RethrowsExceptionFromWorkerThread) {
+  ThreadPool pool(2);
+  const auto callingThread = std::this_thread::get_id();
+  EXPECT_THROW(pool.parallelFor(64, 1,
+                                [&](size_t, size_t) {
+                                  if (std::this_thread::get_id() != callingThread) {
+                                    throw std::invalid_argument("Failed on a worker Thread!");
+                                  }
+                                  std::this_thread::sleep_for(std::chrono::microseconds(100));
+                                }),
+               std::invalid_argument);
+
+  // The pool is still usable afterwards
+  std::atomic<size_t> sum{0};
+  pool.parallelFor(100, 10, [&](size_t begin, size_t end) { sum += end - begin; });
+  EXPECT_EQ(sum.load(), 100u);
+}
+
+TEST(ThreadPoolTest, RunsNestedParallelForOnWorkerThreads) {
+  // Every worker is busy in the outer parallelFor(..), so nobody is left to pick up the helpers of the inner ones.
+  ThreadPool pool(2);
+  std::atomic<size_t> sum{0};
+  pool.parallelFor(6, 1, [&](size_t, size_t) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    pool.parallelFor(100, 10, [&](size_t begin, size_t end) {
+      pool.parallelFor(end - begin, 1, [&](size_t innerBegin, size_t innerEnd) { sum += innerEnd - innerBegin; });
+    });
+  });
+  EXPECT_EQ(sum.load(), 600u);
+}
+
+TEST(ThreadPoolTest, RunsNestedParallelForFromRun) {
+  ThreadPool pool(1);
+  std::atomic<size_t> sum{0};
+  std::atomic<bool> isDone{false};
+  pool.run([&]() {
+    // The only worker runs this task, so the helper stays queued until after parallelFor(..) returned.
+    pool.parallelFor(100, 1, [&](size_t begin, size_t end) { sum += end - begin; });
+    isDone = true;
+  });
+  while (!isDone) {
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(sum.load(), 100u);
+}
+
+TEST(ThreadPoolTest, RunsEveryWorkerInsideWorkerScope) {
+  static thread_local bool isInScope = false;
+  const auto callingThread = std::this_thread::get_id();
+  std::atomic<int> enteredScopes{0};
+  std::atomic<int> exitedScopes{0};
+  std::atomic<int> chunksOutsideScope{0};
+  {
+    ThreadPool pool(3, [&](const std::function<void()>& runWorker) {
+      enteredScopes++;
+      isInScope = true;
+      runWorker();
+      isInScope = false;
+      exitedScopes++;
+    });
+    for (int i = 0; i < 10; i++) {
+      pool.parallelFor(64, 1, [&](size_t, size_t) {
+        if (std::this_thread::get_id() != callingThread && !isInScope) {
+          chunksOutsideScope++;
+        }
+      });
+    }
+  }
+  // Every worker entered its scope once, and left it when the pool was destroyed
+  EXPECT_EQ(enteredScopes.load(), 3);
+  EXPECT_EQ(exitedScopes.load(), 3);
+  EXPECT_EQ(chunksOutsideScope.load(), 0);
+}
@@ -29,10 +29,14 @@ NS_ASSUME_NONNULL_BEGIN
 - (instancetype _Nonnull)initWithWorklet:(std::shared_ptr<RNWorklet::JsiWorklet>)worklet
                                  context:(std::shared_ptr<RNWorklet::JsiWorkletContext>)context;
 
-- (void)callWithFrameHostObject:(std::shared_ptr<FrameHostObject>)frameHostObject;
+- (void)callWithFrameHostObject:(std::shared_ptr<vision::FrameHostObject>)frameHostObject;
 #endif
 
-- (void)call:(Frame*)frame;
+/**
+ * Call the JS Frame Processor with the given Frame.
+ * @param maxFrameDuration The Camera's `activeVideoMaxFrameDuration`, used to detect dropped Frames.
+ */
+- (void)call:(Frame*)frame maxFrameDuration:(CMTime)maxFrameDuration;
 
 @end
 
@@ -7,9 +7,14 @@
 //
 
 #import "FrameProcessor.h"
+#import <CoreMedia/CoreMedia.h>
 #import <Foundation/Foundation.h>
 
 #import "FrameHostObject.h"
+#import "FrameProcessorTimings.h"
+#import "FrameScope.h"
+#import "FrameSequenceTracker.h"
+#import "PlatformFrame.h"
 #import "WKTJsiWorklet.h"
 #import <jsi/jsi.h>
 #import <memory>
@@ -19,6 +24,7 @@ using namespace facebook;
 @implementation FrameProcessor {
   std::shared_ptr<RNWorklet::JsiWorkletContext> _workletContext;
   std::shared_ptr<RNWorklet::WorkletInvoker> _workletInvoker;
+  vision::FrameSequenceTracker _sequenceTracker;
 }
 
 - (instancetype)initWithWorklet:(std::shared_ptr<RNWorklet::JsiWorklet>)worklet
@@ -30,12 +36,14 @@ using namespace facebook;
   return self;
 }
 
-- (void)callWithFrameHostObject:(std::shared_ptr<FrameHostObject>)frameHostObject {
+- (void)callWithFrameHostObject:(std::shared_ptr<vision::FrameHostObject>)frameHostObject {
   // Call the Frame Processor on the Worklet Runtime
   jsi::Runtime& runtime = _workletContext->getWorkletRuntime();
+  vision::ScopedLatencyTimer timer(vision::FrameProcessorTimings::getFrameProcessorHistogram());
 
-  // Use a jsi::Scope to indicate that all values allocated in a Frame Processor shall be picked up by GC if possible
-  jsi::Scope scope(runtime);
+  // Use a jsi::Scope to indicate that all values allocated in a Frame Processor shall be picked up by GC if possible,
+  // and provide the per-Frame scratch arena to plugins.
+  vision::FrameScope scope(runtime);
 
   // Wrap HostObject as JSI Value
   auto argument = jsi::Object::createFromHostObject(runtime, frameHostObject);
@@ -45,10 +53,35 @@ using namespace facebook;
   _workletInvoker->call(runtime, jsi::Value::undefined(), &jsValue, 1);
 }
 
-- (void)call:(Frame* _Nonnull)frame {
+- (void)trackFrame:(Frame* _Nonnull)frame maxFrameDuration:(CMTime)maxFrameDuration {
+  // The presentation timestamp of Camera buffers is in the host time clock
+  CMTime timestamp = CMSampleBufferGetPresentationTimeStamp(frame.buffer);
+  if (!CMTIME_IS_NUMERIC(timestamp)) {
+    return;
+  }
+  int64_t timestampNs = CMTimeConvertScale(timestamp, NSEC_PER_SEC, kCMTimeRoundingMethod_Default).value;
+  CMTime delay = CMTimeSubtract(CMClockGetTime(CMClockGetHostTimeClock()), timestamp);
+  int64_t delayNs = CMTimeConvertScale(delay, NSEC_PER_SEC, kCMTimeRoundingMethod_Default).value;
+  int64_t maxFrameDurationNs = 0;
+  if (CMTIME_IS_NUMERIC(maxFrameDuration)) {
+    maxFrameDurationNs = CMTimeConvertScale(maxFrameDuration, NSEC_PER_SEC, kCMTimeRoundingMethod_Default).value;
+  }
+  _sequenceTracker.onFrame(timestampNs, delayNs, maxFrameDurationNs);
+}
+
+- (void)call:(Frame* _Nonnull)frame maxFrameDuration:(CMTime)maxFrameDuration {
+  [self trackFrame:frame maxFrameDuration:maxFrameDuration];
+
   // Create the Frame Host Object wrapping the internal Frame
-  auto frameHostObject = std::make_shared<FrameHostObject>(frame);
-  [self callWithFrameHostObject:frameHostObject];
+  auto frameHostObject = std::make_shared<vision::FrameHostObject>(std::make_shared<PlatformFrame>(frame));
+  try {
+    [self callWithFrameHostObject:frameHostObject];
+  } catch (...) {
+    frameHostObject->onFrameProcessorFinished();
+    throw;
+  }
+  // The caller releases the CMSampleBuffer after this returns unless JS incremented the Frame's ref-count
+  frameHostObject->onFrameProcessorFinished();
 }
 
 @end
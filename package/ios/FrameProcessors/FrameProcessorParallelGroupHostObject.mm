@@ -0,0 +1,130 @@
+//
+//  FrameProcessorParallelGroupHostObject.mm
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#import "FrameProcessorParallelGroupHostObject.h"
+#import "JSINSObjectConversion.h"
+#import "PlatformFrame.h"
+#import "ThreadPool.h"
+#import <Foundation/Foundation.h>
+#import <exception>
+#import <string>
+#import <vector>
+
+using namespace facebook;
+
+std::shared_ptr<FrameProcessorParallelGroupHostObject> FrameProcessorParallelGroupHostObject::create(jsi::Runtime& runtime,
+                                                                                                     const jsi::Value& stages) {
+  std::vector<Stage> result = FrameProcessorPipelineHostObject::parseStages(runtime, stages, "createParallelGroup");
+  for (size_t i = 0; i < result.size(); i++) {
+    for (size_t j = 0; j < i; j++) {
+      if (result[i].plugin == result[j].plugin) {
+        // A Plugin instance is not expected to be called concurrently with itself
+        throw jsi::JSError(runtime, "createParallelGroup: Stage #" + std::to_string(i) + " uses the same Plugin as stage #" +
+                                        std::to_string(j) + "! Use separate Plugin instances instead.");
+      }
+    }
+  }
+  return std::make_shared<FrameProcessorParallelGroupHostObject>(std::move(result));
+}
+
+namespace {
+
+  /**
+   * Holds a reference on the Frame while the Plugins are running on other Threads.
+   */
+  class FrameReference {
+  public:
+    explicit FrameReference(std::shared_ptr<vision::FrameHostObject> frameHostObject)
+        : _frameHostObject(std::move(frameHostObject)), _isRetained(_frameHostObject->retain()) {}
+    ~FrameReference() {
+      if (_isRetained) {
+        _frameHostObject->release();
+      }
+    }
+
+    FrameReference(const FrameReference&) = delete;
+    FrameReference& operator=(const FrameReference&) = delete;
+
+    bool isRetained() const {
+      return _isRetained;
+    }
+
+  private:
+    std::shared_ptr<vision::FrameHostObject> _frameHostObject;
+    bool _isRetained;
+  };
+
+} // namespace
+
+jsi::Value FrameProcessorParallelGroupHostObject::call(jsi::Runtime& runtime,
+                                                       const std::shared_ptr<vision::FrameHostObject>& frameHostObject) const {
+  FrameReference frameReference(frameHostObject);
+  if (!frameReference.isRetained()) {
+    throw jsi::JSError(runtime, "[capture/frame-invalid] Trying to run Frame Processor Plugins on an already closed Frame!");
+  }
+
+  Frame* frame = PlatformFrame::unwrap(*frameHostObject);
+  std::vector<id> results(_stages.size(), nil);
+  std::vector<NSString*> errors(_stages.size(), nil);
+
+  vision::ThreadPool::getSharedInstance()->parallelFor(_stages.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; i++) {
+      // Worker Threads have no autorelease pool of their own
+      @autoreleasepool {
+        // Errors are rethrown on the JS Thread once all Plugins are done - nothing may escape the worker Thread.
+        try {
+          @try {
+            const Stage& stage = _stages[i];
+            results[i] = stage.plugin->callback(frame, stage.options);
+          } @catch (NSException* exception) {
+            // Objective-C plugin threw an error
+            errors[i] = [NSString stringWithFormat:@"%@: %@", exception.name, exception.reason];
+          }
+        } catch (const std::exception& exception) {
+          // Objective-C++ plugin threw a C++ error
+          errors[i] = [NSString stringWithUTF8String:exception.what()] ?: @"Unknown error";
+        } catch (...) {
+          errors[i] = @"Unknown error";
+        }
+      }
+    }
+  });
+
+  for (size_t i = 0; i < errors.size(); i++) {
+    if (errors[i] != nil) {
+      throw jsi::JSError(runtime, "Frame Processor Plugin #" + std::to_string(i) +
+                                      " of the parallel group threw an error: " + std::string(errors[i].UTF8String));
+    }
+  }
+
+  vision::ScopedLatencyTimer timer(vision::FrameProcessorTimings::getResultConversionHistogram());
+  jsi::Array array(runtime, results.size());
+  for (size_t i = 0; i < results.size(); i++) {
+    array.setValueAtIndex(runtime, i, JSINSObjectConversion::convertObjCObjectToJSIValue(runtime, results[i]));
+  }
+  return array;
+}
+
+std::vector<jsi::PropNameID> FrameProcessorParallelGroupHostObject::getPropertyNames(jsi::Runtime& runtime) {
+  return jsi::PropNameID::names(runtime, "call");
+}
+
+jsi::Value FrameProcessorParallelGroupHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  auto name = propName.utf8(runtime);
+
+  if (name == "call") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "call"), 1,
+        [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          auto frameHostObject = FrameProcessorPluginHostObject::getFrameHostObject(runtime, arguments[0]);
+          return call(runtime, frameHostObject);
+        });
+  }
+
+  return jsi::Value::undefined();
+}
@@ -0,0 +1,57 @@
+//
+//  FrameProcessorPipelineHostObject.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#import "FrameProcessorPluginHostObject.h"
+#import <Foundation/Foundation.h>
+#import <jsi/jsi.h>
+#import <memory>
+#import <string>
+#import <vector>
+
+using namespace facebook;
+
+/**
+ * A chain of Frame Processor Plugins that runs on a Frame in a single call (`VisionCameraProxy.createPipeline(..)`).
+ *
+ * The Frame is unwrapped once, the options of every stage are converted once when the pipeline is created, and every
+ * stage receives the native result of the previous stage as `previousResult` in its arguments.
+ * Only the result of the last stage is converted to JS.
+ */
+class FrameProcessorPipelineHostObject : public jsi::HostObject {
+public:
+  struct Stage {
+    std::shared_ptr<FrameProcessorPluginHostObject> plugin;
+    NSDictionary* options;
+  };
+
+public:
+  explicit FrameProcessorPipelineHostObject(std::vector<Stage> stages) : _stages(std::move(stages)) {}
+
+  /**
+   * Creates a pipeline from an array of Plugins or `{ plugin, options }` objects.
+   * Throws a `jsi::JSError` if the stages are invalid.
+   */
+  static std::shared_ptr<FrameProcessorPipelineHostObject> create(jsi::Runtime& runtime, const jsi::Value& stages);
+  /**
+   * Parses an array of Plugins or `{ plugin, options }` objects and converts their options.
+   * Throws a `jsi::JSError` prefixed with `functionName` if the stages are invalid.
+   */
+  static std::vector<Stage> parseStages(jsi::Runtime& runtime, const jsi::Value& stages, const std::string& functionName);
+
+public:
+  std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
+  jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
+
+private:
+  id call(Frame* frame) const;
+
+private:
+  std::vector<Stage> _stages;
+};
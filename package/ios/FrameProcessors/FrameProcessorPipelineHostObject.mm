@@ -0,0 +1,105 @@
+//
+//  FrameProcessorPipelineHostObject.mm
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#import "FrameProcessorPipelineHostObject.h"
+#import "JSINSObjectConversion.h"
+#import "PlatformFrame.h"
+#import <Foundation/Foundation.h>
+#import <string>
+#import <vector>
+
+using namespace facebook;
+
+static NSString* const kPreviousResultKey = @"previousResult";
+
+std::vector<FrameProcessorPipelineHostObject::Stage>
+FrameProcessorPipelineHostObject::parseStages(jsi::Runtime& runtime, const jsi::Value& stages, const std::string& functionName) {
+  if (!stages.isObject() || !stages.getObject(runtime).isArray(runtime)) {
+    throw jsi::JSError(runtime, functionName + ": First argument needs to be an array of Frame Processor Plugins!");
+  }
+  jsi::Array array = stages.getObject(runtime).getArray(runtime);
+  size_t size = array.size(runtime);
+  if (size == 0) {
+    throw jsi::JSError(runtime, functionName + ": At least one Frame Processor Plugin is required!");
+  }
+
+  std::vector<Stage> result;
+  result.reserve(size);
+  for (size_t i = 0; i < size; i++) {
+    jsi::Value item = array.getValueAtIndex(runtime, i);
+    if (!item.isObject()) {
+      throw jsi::JSError(runtime, functionName + ": Stage #" + std::to_string(i) + " is not a Frame Processor Plugin!");
+    }
+    jsi::Object itemObject = item.getObject(runtime);
+
+    Stage stage;
+    stage.options = nil;
+    if (itemObject.isHostObject<FrameProcessorPluginHostObject>(runtime)) {
+      // plugin
+      stage.plugin = itemObject.getHostObject<FrameProcessorPluginHostObject>(runtime);
+    } else {
+      // { plugin, options }
+      jsi::Value plugin = itemObject.getProperty(runtime, "plugin");
+      if (!plugin.isObject() || !plugin.getObject(runtime).isHostObject<FrameProcessorPluginHostObject>(runtime)) {
+        throw jsi::JSError(runtime, functionName + ": Stage #" + std::to_string(i) + " is not a Frame Processor Plugin!");
+      }
+      stage.plugin = plugin.getObject(runtime).getHostObject<FrameProcessorPluginHostObject>(runtime);
+      // Converted once here, instead of on every Frame
+      stage.options = stage.plugin->getOptions(runtime, itemObject.getProperty(runtime, "options"));
+    }
+    result.push_back(std::move(stage));
+  }
+  return result;
+}
+
+std::shared_ptr<FrameProcessorPipelineHostObject> FrameProcessorPipelineHostObject::create(jsi::Runtime& runtime,
+                                                                                           const jsi::Value& stages) {
+  return std::make_shared<FrameProcessorPipelineHostObject>(parseStages(runtime, stages, "createPipeline"));
+}
+
+id FrameProcessorPipelineHostObject::call(Frame* frame) const {
+  id result = _stages[0].plugin->callback(frame, _stages[0].options);
+  for (size_t i = 1; i < _stages.size(); i++) {
+    // The previous result is passed on natively, without converting it to JS and back
+    const Stage& stage = _stages[i];
+    NSMutableDictionary* arguments = stage.options != nil ? [stage.options mutableCopy] : [NSMutableDictionary new];
+    arguments[kPreviousResultKey] = result;
+    result = stage.plugin->callback(frame, arguments);
+  }
+  return result;
+}
+
+std::vector<jsi::PropNameID> FrameProcessorPipelineHostObject::getPropertyNames(jsi::Runtime& runtime) {
+  return jsi::PropNameID::names(runtime, "call");
+}
+
+jsi::Value FrameProcessorPipelineHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
+  auto name = propName.utf8(runtime);
+
+  if (name == "call") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "call"), 1,
+        [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          Frame* frame = PlatformFrame::unwrap(*FrameProcessorPluginHostObject::getFrameHostObject(runtime, arguments[0]));
+
+          @try {
+            id result = call(frame);
+
+            // Only the result of the last stage is converted to jsi::Value
+            vision::ScopedLatencyTimer timer(vision::FrameProcessorTimings::getResultConversionHistogram());
+            return JSINSObjectConversion::convertObjCObjectToJSIValue(runtime, result);
+          } @catch (NSException* exception) {
+            // Objective-C plugin threw an error.
+            NSString* message = [NSString stringWithFormat:@"%@: %@", exception.name, exception.reason];
+            throw jsi::JSError(runtime, message.UTF8String);
+          }
+        });
+  }
+
+  return jsi::Value::undefined();
+}
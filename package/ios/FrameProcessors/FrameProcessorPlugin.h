@@ -45,9 +45,15 @@ NS_ASSUME_NONNULL_BEGIN
  * Implement your Frame Processing here, and keep in mind that this is a hot-path so optimize as good as possible.
  * See: <a href="https://react-native-vision-camera.com/docs/guides/frame-processors-tips#fast-frame-processor-plugins">Performance Tips</a>
  *
+ * In a parallel group (`VisionCameraProxy.createParallelGroup(..)`), this is called on a native worker Thread,
+ * concurrently with the other Plugins of the group.
+ *
  * - Parameters:
  *   - frame: The Frame from the Camera. Don't do any ref-counting on this, as VisionCamera handles that.
  *   - arguments: An options dictionary passed from the JS side, or `nil` if none.
+ *                Unchanged options reuse the same dictionary instance across calls.
+ *                In a pipeline (`VisionCameraProxy.createPipeline(..)`), it also contains the result of the previous Plugin
+ *                as `previousResult`.
  * - Returns: You can return any primitive, map or array you want.
  *            See the <a href="https://react-native-vision-camera.com/docs/guides/frame-processors-plugins-overview#types">Types</a>
  *            table for a list of supported types.
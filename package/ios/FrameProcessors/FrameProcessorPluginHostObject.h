@@ -8,24 +8,46 @@
 
 #pragma once
 
+#import "FrameHostObject.h"
 #import "FrameProcessorPlugin.h"
+#import "FrameProcessorTimings.h"
+#import "PluginOptionsCache.h"
 #import <ReactCommon/CallInvoker.h>
 #import <jsi/jsi.h>
 #import <memory>
+#import <string>
 
 using namespace facebook;
 
 class FrameProcessorPluginHostObject : public jsi::HostObject {
 public:
-  explicit FrameProcessorPluginHostObject(FrameProcessorPlugin* plugin, std::shared_ptr<react::CallInvoker> callInvoker)
-      : _plugin(plugin), _callInvoker(callInvoker) {}
+  explicit FrameProcessorPluginHostObject(FrameProcessorPlugin* plugin, const std::string& name,
+                                          std::shared_ptr<react::CallInvoker> callInvoker)
+      : _plugin(plugin), _callInvoker(callInvoker), _callbackTimings(vision::FrameProcessorTimings::getPluginHistogram(name)) {}
   ~FrameProcessorPluginHostObject() {}
 
 public:
   std::vector<jsi::PropNameID> getPropertyNames(jsi::Runtime& runtime) override;
   jsi::Value get(jsi::Runtime& runtime, const jsi::PropNameID& name) override;
 
+public:
+  /**
+   * Get the FrameHostObject of a Frame, or of a wrapper like `DrawableFrame`.
+   */
+  static std::shared_ptr<vision::FrameHostObject> getFrameHostObject(jsi::Runtime& runtime, const jsi::Value& value);
+  /**
+   * Get the native options of prepared options, or convert them through the cache. Returns `nil` if there are no options.
+   */
+  NSDictionary* getOptions(jsi::Runtime& runtime, const jsi::Value& value);
+
+  /**
+   * Calls the Objective-C/Swift Plugin, and records how long it took.
+   */
+  id callback(Frame* frame, NSDictionary* arguments) const;
+
 private:
   FrameProcessorPlugin* _plugin;
   std::shared_ptr<react::CallInvoker> _callInvoker;
+  vision::PluginOptionsCache<NSDictionary*> _optionsCache;
+  std::shared_ptr<vision::LatencyHistogram> _callbackTimings;
 };
@@ -9,13 +9,44 @@
 #import "FrameProcessorPluginHostObject.h"
 #import "FrameHostObject.h"
 #import "JSINSObjectConversion.h"
+#import "PlatformFrame.h"
 #import <Foundation/Foundation.h>
 #import <vector>
 
 using namespace facebook;
 
 std::vector<jsi::PropNameID> FrameProcessorPluginHostObject::getPropertyNames(jsi::Runtime& runtime) {
-  return jsi::PropNameID::names(runtime, "call");
+  return jsi::PropNameID::names(runtime, "call", "prepare");
+}
+
+std::shared_ptr<vision::FrameHostObject> FrameProcessorPluginHostObject::getFrameHostObject(jsi::Runtime& runtime,
+                                                                                           const jsi::Value& value) {
+  auto frameHolder = value.asObject(runtime);
+  if (frameHolder.isHostObject<vision::FrameHostObject>(runtime)) {
+    // User directly passed FrameHostObject
+    return frameHolder.getHostObject<vision::FrameHostObject>(runtime);
+  } else {
+    // User passed a wrapper, e.g. DrawableFrame which contains the FrameHostObject as a hidden property
+    jsi::Object actualFrame = frameHolder.getPropertyAsObject(runtime, "__frame");
+    return actualFrame.asHostObject<vision::FrameHostObject>(runtime);
+  }
+}
+
+NSDictionary* FrameProcessorPluginHostObject::getOptions(jsi::Runtime& runtime, const jsi::Value& value) {
+  if (!value.isObject()) {
+    return nil;
+  }
+  vision::ScopedLatencyTimer timer(vision::FrameProcessorTimings::getArgumentConversionHistogram());
+  jsi::Object optionsObject = value.getObject(runtime);
+  if (optionsObject.isHostObject<vision::PreparedPluginOptions<NSDictionary*>>(runtime)) {
+    return optionsObject.getHostObject<vision::PreparedPluginOptions<NSDictionary*>>(runtime)->getOptions();
+  }
+  return _optionsCache.get(runtime, optionsObject, &JSINSObjectConversion::convertJSIObjectToObjCDictionary);
+}
+
+id FrameProcessorPluginHostObject::callback(Frame* frame, NSDictionary* arguments) const {
+  vision::ScopedLatencyTimer timer(*_callbackTimings);
+  return [_plugin callback:frame withArguments:arguments];
 }
 
 jsi::Value FrameProcessorPluginHostObject::get(jsi::Runtime& runtime, const jsi::PropNameID& propName) {
@@ -26,30 +57,17 @@ jsi::Value FrameProcessorPluginHostObject::get(jsi::Runtime& runtime, const jsi:
         runtime, jsi::PropNameID::forUtf8(runtime, "call"), 2,
         [=](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
           // Frame is first argument
-          auto frameHolder = arguments[0].asObject(runtime);
-          std::shared_ptr<FrameHostObject> frameHostObject;
-          if (frameHolder.isHostObject<FrameHostObject>(runtime)) {
-            // User directly passed FrameHostObject
-            frameHostObject = frameHolder.getHostObject<FrameHostObject>(runtime);
-          } else {
-            // User passed a wrapper, e.g. DrawableFrame which contains the FrameHostObject as a hidden property
-            jsi::Object actualFrame = frameHolder.getPropertyAsObject(runtime, "__frame");
-            frameHostObject = actualFrame.asHostObject<FrameHostObject>(runtime);
-          }
-          Frame* frame = frameHostObject->getFrame();
+          Frame* frame = PlatformFrame::unwrap(*getFrameHostObject(runtime, arguments[0]));
 
-          // Options are second argument (possibly undefined)
-          NSDictionary* options = nil;
-          if (count > 1) {
-            auto optionsObject = arguments[1].asObject(runtime);
-            options = JSINSObjectConversion::convertJSIObjectToObjCDictionary(runtime, optionsObject);
-          }
+          // Options are second argument (possibly undefined), either prepared or converted through the cache
+          NSDictionary* options = count > 1 ? getOptions(runtime, arguments[1]) : nil;
 
           @try {
             // Call actual Frame Processor Plugin
-            id result = [_plugin callback:frame withArguments:options];
+            id result = callback(frame, options);
 
             // Convert result value to jsi::Value (possibly undefined)
+            vision::ScopedLatencyTimer timer(vision::FrameProcessorTimings::getResultConversionHistogram());
             return JSINSObjectConversion::convertObjCObjectToJSIValue(runtime, result);
           } @catch (NSException* exception) {
             // Objective-C plugin threw an error.
@@ -58,6 +76,20 @@ jsi::Value FrameProcessorPluginHostObject::get(jsi::Runtime& runtime, const jsi:
           }
         });
   }
+  if (name == "prepare") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "prepare"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1 || !arguments[0].isObject()) {
+            throw jsi::JSError(runtime, "FrameProcessorPlugin.prepare(..): The first argument has to be an options object!");
+          }
+          // Converts the options once, the returned handle can be passed to every call(..)
+          NSDictionary* options = JSINSObjectConversion::convertJSIObjectToObjCDictionary(runtime, arguments[0].getObject(runtime));
+          vision::PluginOptions::recordConversion();
+          auto prepared = std::make_shared<vision::PreparedPluginOptions<NSDictionary*>>(options);
+          return jsi::Object::createFromHostObject(runtime, prepared);
+        });
+  }
 
   return jsi::Value::undefined();
 }
@@ -18,7 +18,12 @@
 #import "JSINSObjectConversion.h"
 #import "Frame.h"
 #import "FrameHostObject.h"
+#import "ObjectShape.h"
+#import "PlatformFrame.h"
+#import "RuntimeCache.h"
 #import "SharedArray.h"
+#import "TypedArray.h"
+#import "TypedResultSchema.h"
 #import <Foundation/Foundation.h>
 #import <ReactCommon/CallInvoker.h>
 #import <jsi/jsi.h>
@@ -33,6 +38,11 @@ jsi::Value convertObjCObjectToJSIValue(jsi::Runtime& runtime, id value) {
     // null
 
     return jsi::Value::undefined();
+  } else if ([value isKindOfClass:[TypedResult class]]) {
+    // TypedResult - checked first since it is the fast path for large results
+
+    TypedResult* typedResult = (TypedResult*)value;
+    return [typedResult toJSIValue:runtime];
   } else if ([value isKindOfClass:[NSNumber class]]) {
     NSNumber* number = (NSNumber*)value;
     if ([value isKindOfClass:[@YES class]]) {
@@ -67,11 +77,16 @@ jsi::Value convertObjCObjectToJSIValue(jsi::Runtime& runtime, id value) {
       result.setValueAtIndex(runtime, i, convertObjCObjectToJSIValue(runtime, value[i]));
     }
     return result;
+  } else if ([value isKindOfClass:[NSData class]]) {
+    // NSData -> Uint8Array, a single copy into a pooled buffer
+
+    NSData* data = (NSData*)value;
+    return vision::TypedArrays::createCopy(runtime, vision::TypedArrayKind::Uint8, data.bytes, data.length);
   } else if ([value isKindOfClass:[Frame class]]) {
     // Frame
 
     Frame* frame = (Frame*)value;
-    auto frameHostObject = std::make_shared<FrameHostObject>(frame);
+    auto frameHostObject = std::make_shared<vision::FrameHostObject>(std::make_shared<PlatformFrame>(frame));
     return jsi::Object::createFromHostObject(runtime, frameHostObject);
   } else if ([value isKindOfClass:[SharedArray class]]) {
     // SharedArray
@@ -85,14 +100,73 @@ jsi::Value convertObjCObjectToJSIValue(jsi::Runtime& runtime, id value) {
   throw std::runtime_error("Cannot convert Objective-C type \"" + classNameString + "\" to jsi::Value!");
 }
 
+using NSKeyCache = vision::PropertyKeyCache<NSString*>;
+
+static NSString* getKey(jsi::Runtime& runtime, const std::string& name) {
+  // Keys are converted to NSStrings once per Runtime instead of once per object.
+  return vision::RuntimeCache<NSKeyCache>::get(runtime).get(
+      name, [](const std::string& keyName) { return [NSString stringWithUTF8String:keyName.c_str()]; });
+}
+
+static NSDictionary* convertShapedObject(jsi::Runtime& runtime, const jsi::Object& object, const vision::ObjectShape& shape,
+                                         NSArray<NSString*>* keys) {
+  NSMutableDictionary* result = [NSMutableDictionary dictionaryWithCapacity:shape.size()];
+  for (size_t i = 0; i < shape.size(); i++) {
+    jsi::Value value = object.getProperty(runtime, shape.getPropName(i));
+    result[keys[i]] = convertJSIValueToObjCObject(runtime, value);
+  }
+  return [result copy];
+}
+
+static NSArray* convertJSIArrayToObjCArray(jsi::Runtime& runtime, const jsi::Array& array) {
+  size_t size = array.size(runtime);
+  NSMutableArray* result = [NSMutableArray arrayWithCapacity:size];
+  if (size == 0) {
+    return [result copy];
+  }
+
+  jsi::Value first = array.getValueAtIndex(runtime, 0);
+  if (size > 1 && first.isObject() && vision::ObjectShape::isPlainObject(runtime, first.getObject(runtime))) {
+    // Homogeneous array of objects (e.g. bounding boxes): all elements that have the same keys as the first one
+    // share its property names and NSString keys, instead of enumerating and converting them for every element.
+    jsi::Object firstObject = first.getObject(runtime);
+    vision::ObjectShape shape(runtime, firstObject);
+    NSMutableArray<NSString*>* keys = [NSMutableArray arrayWithCapacity:shape.size()];
+    for (size_t i = 0; i < shape.size(); i++) {
+      [keys addObject:getKey(runtime, shape.getName(i))];
+    }
+
+    [result addObject:convertShapedObject(runtime, firstObject, shape, keys)];
+    for (size_t i = 1; i < size; i++) {
+      jsi::Value item = array.getValueAtIndex(runtime, i);
+      if (item.isObject()) {
+        jsi::Object itemObject = item.getObject(runtime);
+        if (vision::ObjectShape::isPlainObject(runtime, itemObject) && shape.matches(runtime, itemObject)) {
+          [result addObject:convertShapedObject(runtime, itemObject, shape, keys)];
+          continue;
+        }
+      }
+      [result addObject:convertJSIValueToObjCObject(runtime, item)];
+    }
+    return [result copy];
+  }
+
+  [result addObject:convertJSIValueToObjCObject(runtime, first)];
+  for (size_t i = 1; i < size; i++) {
+    jsi::Value value = array.getValueAtIndex(runtime, i);
+    [result addObject:convertJSIValueToObjCObject(runtime, value)];
+  }
+  return [result copy];
+}
+
 NSDictionary* convertJSIObjectToObjCDictionary(jsi::Runtime& runtime, const jsi::Object& object) {
   jsi::Array propertyNames = object.getPropertyNames(runtime);
   size_t size = propertyNames.size(runtime);
-  NSMutableDictionary* result = [NSMutableDictionary new];
+  NSMutableDictionary* result = [NSMutableDictionary dictionaryWithCapacity:size];
   for (size_t i = 0; i < size; i++) {
     jsi::String name = propertyNames.getValueAtIndex(runtime, i).getString(runtime);
     jsi::Value value = object.getProperty(runtime, name);
-    NSString* key = [NSString stringWithUTF8String:name.utf8(runtime).c_str()];
+    NSString* key = getKey(runtime, name.utf8(runtime));
     result[key] = convertJSIValueToObjCObject(runtime, value);
   }
   return [result copy];
@@ -118,18 +192,12 @@ id convertJSIValueToObjCObject(jsi::Runtime& runtime, const jsi::Value& value) {
     if (object.isArray(runtime)) {
       // array[]
       jsi::Array array = object.getArray(runtime);
-      size_t size = array.size(runtime);
-      NSMutableArray* result = [NSMutableArray new];
-      for (size_t i = 0; i < size; i++) {
-        jsi::Value value = array.getValueAtIndex(runtime, i);
-        [result addObject:convertJSIValueToObjCObject(runtime, value)];
-      }
-      return [result copy];
+      return convertJSIArrayToObjCArray(runtime, array);
     } else if (object.isHostObject(runtime)) {
-      if (object.isHostObject<FrameHostObject>(runtime)) {
+      if (object.isHostObject<vision::FrameHostObject>(runtime)) {
         // Frame
-        auto hostObject = object.getHostObject<FrameHostObject>(runtime);
-        return hostObject->getFrame();
+        auto hostObject = object.getHostObject<vision::FrameHostObject>(runtime);
+        return PlatformFrame::unwrap(*hostObject);
       } else {
         throw std::runtime_error("The given HostObject is not supported by a Frame Processor Plugin!");
       }
@@ -137,6 +205,9 @@ id convertJSIValueToObjCObject(jsi::Runtime& runtime, const jsi::Value& value) {
       // ArrayBuffer
       auto arrayBuffer = std::make_shared<jsi::ArrayBuffer>(object.getArrayBuffer(runtime));
       return [[SharedArray alloc] initWithRuntime:runtime wrapArrayBuffer:arrayBuffer];
+    } else if (auto typedArray = vision::TypedArrays::getView(runtime, object)) {
+      // TypedArray -> NSData, a single copy of the raw elements
+      return [NSData dataWithBytes:typedArray->data length:typedArray->byteLength];
     } else {
       // object
       return convertJSIObjectToObjCDictionary(runtime, object);
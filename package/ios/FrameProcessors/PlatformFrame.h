@@ -0,0 +1,64 @@
+//
+//  PlatformFrame.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#import "Frame.h"
+#import "FrameHostObject.h"
+#import "FrameMetadata.h"
+#import "NativeFrame.h"
+#import <memory>
+#import <vector>
+
+/**
+ * The `NativeFrame` of a Camera Frame on iOS, backed by the `Frame`'s `CMSampleBuffer`.
+ */
+class PlatformFrame : public vision::NativeFrame {
+public:
+  explicit PlatformFrame(Frame* frame);
+
+public:
+  const vision::FrameMetadata& getMetadata() const override {
+    return _metadata;
+  }
+  bool getIsValid() const override {
+    return _frame != nil && _frame.isValid;
+  }
+  std::vector<vision::FramePlane> lockPlanes(std::shared_ptr<void>& lock) override;
+  uint8_t* lockBuffer(std::shared_ptr<void>& lock, size_t& size) override;
+  vision::NativeBuffer getNativeBuffer() override;
+  // RGB Frames are BGRA on iOS.
+  vision::PixelLayout getPackedLayout() const override {
+    return vision::PixelLayout::BGRA;
+  }
+  bool getIsFullRange() const override {
+    return _isFullRange;
+  }
+  void retain() override {
+    [_frame incrementRefCount];
+  }
+  void release() override {
+    [_frame decrementRefCount];
+  }
+
+public:
+  inline Frame* getFrame() const noexcept {
+    return _frame;
+  }
+
+  /**
+   * Get the `Frame` of the given Frame Host Object.
+   * Throws if the Frame is not a Camera Frame (e.g. a `SyntheticFrame`), which cannot be passed to Objective-C.
+   */
+  static Frame* unwrap(const vision::FrameHostObject& frameHostObject);
+
+private:
+  Frame* _frame;
+  vision::FrameMetadata _metadata;
+  bool _isFullRange;
+};
@@ -0,0 +1,182 @@
+//
+//  PlatformFrame.mm
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 16.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#import "PlatformFrame.h"
+#import <CoreMedia/CoreMedia.h>
+#import <CoreVideo/CoreVideo.h>
+#import <Foundation/Foundation.h>
+#import <stdexcept>
+
+/**
+ * Retains and read-locks the given CVPixelBuffer, and unlocks and releases it once the last reference is gone.
+ */
+static std::shared_ptr<void> createPixelBufferLock(CVPixelBufferRef pixelBuffer) {
+  CVPixelBufferRetain(pixelBuffer);
+  CVPixelBufferLockBaseAddress(pixelBuffer, kCVPixelBufferLock_ReadOnly);
+  return std::shared_ptr<void>(pixelBuffer, [](void* pointer) {
+    auto lockedBuffer = static_cast<CVPixelBufferRef>(pointer);
+    CVPixelBufferUnlockBaseAddress(lockedBuffer, kCVPixelBufferLock_ReadOnly);
+    CVPixelBufferRelease(lockedBuffer);
+  });
+}
+
+/**
+ * Get the distance between two pixels of a row of the given plane, in bytes.
+ * Throws for packed formats, whose pixels don't start at a byte boundary.
+ */
+static int32_t getPixelStride(OSType pixelFormat, size_t planeIndex) {
+  switch (pixelFormat) {
+    case kCVPixelFormatType_32BGRA:
+    case kCVPixelFormatType_Lossy_32BGRA:
+      return 4;
+    case kCVPixelFormatType_420YpCbCr8BiPlanarFullRange:
+    case kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+    case kCVPixelFormatType_Lossy_420YpCbCr8BiPlanarFullRange:
+    case kCVPixelFormatType_Lossy_420YpCbCr8BiPlanarVideoRange:
+      // Y plane, then interleaved CbCr plane
+      return planeIndex == 0 ? 1 : 2;
+    case kCVPixelFormatType_420YpCbCr10BiPlanarFullRange:
+    case kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange:
+      return planeIndex == 0 ? 2 : 4;
+    case kCVPixelFormatType_Lossy_420YpCbCr10PackedBiPlanarVideoRange:
+    case kCVPixelFormatType_Lossless_420YpCbCr10PackedBiPlanarVideoRange:
+      // Three 10-bit samples are packed into every 4 bytes
+      throw std::runtime_error("Frame has an unsupported pixel format (packed 10-bit YUV), its planes cannot be accessed! "
+                               "Disable `enableBufferCompression` when using `videoHdr`.");
+    default:
+      return 1;
+  }
+}
+
+/**
+ * Get the orientation of the given Frame, matching `NSString+stringWithParsed:`.
+ */
+static vision::FrameOrientation getFrameOrientation(UIImageOrientation orientation) {
+  switch (orientation) {
+    case UIImageOrientationUp:
+    case UIImageOrientationUpMirrored:
+      return vision::FrameOrientation::Portrait;
+    case UIImageOrientationDown:
+    case UIImageOrientationDownMirrored:
+      return vision::FrameOrientation::PortraitUpsideDown;
+    case UIImageOrientationLeft:
+    case UIImageOrientationLeftMirrored:
+      return vision::FrameOrientation::LandscapeRight;
+    case UIImageOrientationRight:
+    case UIImageOrientationRightMirrored:
+      return vision::FrameOrientation::LandscapeLeft;
+  }
+  return vision::FrameOrientation::Portrait;
+}
+
+/**
+ * Get the pixel format of the given Frame, matching `Frame.pixelFormat`.
+ */
+static vision::FramePixelFormat getFramePixelFormat(NSString* pixelFormat) {
+  if ([pixelFormat isEqualToString:@"yuv"]) {
+    return vision::FramePixelFormat::YUV;
+  }
+  if ([pixelFormat isEqualToString:@"rgb"]) {
+    return vision::FramePixelFormat::RGB;
+  }
+  return vision::FramePixelFormat::Unknown;
+}
+
+/**
+ * Get whether the given YUV pixel format uses the full [0...255] range instead of the video range [16...235].
+ */
+static bool getIsFullRange(OSType pixelFormat) {
+  switch (pixelFormat) {
+    case kCVPixelFormatType_420YpCbCr8BiPlanarVideoRange:
+    case kCVPixelFormatType_Lossy_420YpCbCr8BiPlanarVideoRange:
+    case kCVPixelFormatType_420YpCbCr10BiPlanarVideoRange:
+      return false;
+    default:
+      return true;
+  }
+}
+
+/**
+ * Get all planes of the given locked CVPixelBuffer. Non-planar buffers are returned as a single plane.
+ */
+static std::vector<vision::FramePlane> getPixelBufferPlanes(CVPixelBufferRef pixelBuffer) {
+  OSType pixelFormat = CVPixelBufferGetPixelFormatType(pixelBuffer);
+
+  std::vector<vision::FramePlane> planes;
+  if (CVPixelBufferIsPlanar(pixelBuffer)) {
+    size_t planesCount = CVPixelBufferGetPlaneCount(pixelBuffer);
+    planes.reserve(planesCount);
+    for (size_t i = 0; i < planesCount; i++) {
+      vision::FramePlane plane;
+      plane.data = static_cast<uint8_t*>(CVPixelBufferGetBaseAddressOfPlane(pixelBuffer, i));
+      plane.width = static_cast<int32_t>(CVPixelBufferGetWidthOfPlane(pixelBuffer, i));
+      plane.height = static_cast<int32_t>(CVPixelBufferGetHeightOfPlane(pixelBuffer, i));
+      plane.bytesPerRow = static_cast<int32_t>(CVPixelBufferGetBytesPerRowOfPlane(pixelBuffer, i));
+      plane.pixelStride = getPixelStride(pixelFormat, i);
+      planes.push_back(plane);
+    }
+  } else {
+    vision::FramePlane plane;
+    plane.data = static_cast<uint8_t*>(CVPixelBufferGetBaseAddress(pixelBuffer));
+    plane.width = static_cast<int32_t>(CVPixelBufferGetWidth(pixelBuffer));
+    plane.height = static_cast<int32_t>(CVPixelBufferGetHeight(pixelBuffer));
+    plane.bytesPerRow = static_cast<int32_t>(CVPixelBufferGetBytesPerRow(pixelBuffer));
+    plane.pixelStride = getPixelStride(pixelFormat, 0);
+    planes.push_back(plane);
+  }
+  return planes;
+}
+
+PlatformFrame::PlatformFrame(Frame* frame) : _frame(frame), _metadata(), _isFullRange(true) {
+  if (frame == nil || !frame.isValid) {
+    // Closed Frames only ever expose `isValid` and `toString()`, which don't need the metadata.
+    _metadata.pixelFormat = vision::FramePixelFormat::Unknown;
+    return;
+  }
+  // Read all metadata once, so JS property reads don't have to go through the CMSampleBuffer again.
+  _metadata.width = static_cast<int32_t>(frame.width);
+  _metadata.height = static_cast<int32_t>(frame.height);
+  _metadata.bytesPerRow = static_cast<int32_t>(frame.bytesPerRow);
+  _metadata.planesCount = static_cast<int32_t>(frame.planesCount);
+  _metadata.timestamp = frame.timestamp;
+  _metadata.orientation = getFrameOrientation(frame.orientation);
+  _metadata.pixelFormat = getFramePixelFormat(frame.pixelFormat);
+  _metadata.isMirrored = frame.isMirrored;
+  _isFullRange = getIsFullRange(CVPixelBufferGetPixelFormatType(CMSampleBufferGetImageBuffer(frame.buffer)));
+}
+
+Frame* PlatformFrame::unwrap(const vision::FrameHostObject& frameHostObject) {
+  auto platformFrame = std::dynamic_pointer_cast<PlatformFrame>(frameHostObject.getNativeFrame());
+  if (platformFrame == nullptr) {
+    throw std::runtime_error("This Frame is not a Camera Frame, and cannot be passed to native Frame Processor Plugins!");
+  }
+  return platformFrame->getFrame();
+}
+
+std::vector<vision::FramePlane> PlatformFrame::lockPlanes(std::shared_ptr<void>& lock) {
+  CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(_frame.buffer);
+  lock = createPixelBufferLock(pixelBuffer);
+  return getPixelBufferPlanes(pixelBuffer);
+}
+
+uint8_t* PlatformFrame::lockBuffer(std::shared_ptr<void>& lock, size_t& size) {
+  CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(_frame.buffer);
+  lock = createPixelBufferLock(pixelBuffer);
+  size = CVPixelBufferGetBytesPerRow(pixelBuffer) * CVPixelBufferGetHeight(pixelBuffer);
+  return static_cast<uint8_t*>(CVPixelBufferGetBaseAddress(pixelBuffer));
+}
+
+vision::NativeBuffer PlatformFrame::getNativeBuffer() {
+  // Box-cast to uintptr (just 64-bit address)
+  CVPixelBufferRef pixelBuffer = CMSampleBufferGetImageBuffer(_frame.buffer);
+  vision::NativeBuffer buffer;
+  buffer.pointer = reinterpret_cast<uintptr_t>(pixelBuffer);
+  // no-op as memory is managed by the parent Frame (decrementRefCount())
+  buffer.release = nullptr;
+  return buffer;
+}
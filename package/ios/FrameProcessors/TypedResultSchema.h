@@ -0,0 +1,98 @@
+//
+//  TypedResultSchema.h
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#pragma once
+
+#import <Foundation/Foundation.h>
+
+#ifdef __cplusplus
+#import <jsi/jsi.h>
+using namespace facebook;
+#endif
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSInteger, TypedResultDataType) {
+  // 32-bit float, a `Float32Array` in JS
+  TypedResultDataTypeFloat32,
+  // 32-bit signed integer, an `Int32Array` in JS
+  TypedResultDataTypeInt32,
+};
+
+@class TypedResult;
+
+/**
+ * Describes the layout of the values a Frame Processor Plugin returns as a `TypedResult`.
+ * A schema is a struct-of-arrays: Array fields hold up to `capacity` rows of a fixed number of components,
+ * Tensor fields hold a fixed number of values. In JS, every field becomes a `Float32Array` or `Int32Array`
+ * of one shared `ArrayBuffer`, without boxing individual values.
+ *
+ * Create the schema once (e.g. in the Plugin's initializer), fields cannot be added after a result has been created.
+ */
+@interface TypedResultSchema : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Creates a new schema whose Array fields hold up to `capacity` rows, e.g. the maximum number of detected faces.
+ */
+- (instancetype)initWithCapacity:(NSInteger)capacity;
+
+/**
+ * Adds an Array field with `componentsCount` values per row.
+ */
+- (void)addArrayWithName:(NSString*)name dataType:(TypedResultDataType)dataType componentsCount:(NSInteger)componentsCount;
+/**
+ * Adds a Tensor field with a fixed shape, e.g. a segmentation mask.
+ */
+- (void)addTensorWithName:(NSString*)name dataType:(TypedResultDataType)dataType shape:(NSArray<NSNumber*>*)shape;
+
+/**
+ * Creates a new result backed by a pooled native buffer. Create a new result for every call of the Plugin.
+ */
+- (TypedResult*)createResult;
+
+/**
+ * The maximum number of rows of Array fields.
+ */
+@property(nonatomic, readonly) NSInteger capacity;
+
+@end
+
+/**
+ * A preallocated native buffer laid out by a `TypedResultSchema`.
+ * Write the values into the field buffers, set the number of valid rows with `count`, and return the result
+ * from the Plugin's `callback`. In JS it becomes `{ count, [field]: Float32Array | Int32Array }`.
+ *
+ * The contents of a new result are undefined. The field buffers are only valid as long as this result is referenced.
+ */
+@interface TypedResult : NSObject
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/**
+ * Gets the buffer of the given `Float32` field.
+ */
+- (float*)float32DataForField:(NSString*)field NS_RETURNS_INNER_POINTER;
+/**
+ * Gets the buffer of the given `Int32` field.
+ */
+- (int32_t*)int32DataForField:(NSString*)field NS_RETURNS_INNER_POINTER;
+
+#ifdef __cplusplus
+- (jsi::Value)toJSIValue:(jsi::Runtime&)runtime;
+#endif
+
+/**
+ * The number of valid rows of all Array fields. Must not exceed the capacity of the schema.
+ */
+@property(nonatomic) NSInteger count;
+
+@end
+
+NS_ASSUME_NONNULL_END
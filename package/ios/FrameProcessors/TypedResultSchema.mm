@@ -0,0 +1,145 @@
+//
+//  TypedResultSchema.mm
+//  VisionCamera
+//
+//  Created by Marc Rousavy on 15.10.26.
+//  Copyright © 2026 mrousavy. All rights reserved.
+//
+
+#import "TypedResultSchema.h"
+#import "TypedResult.h"
+#import <Foundation/Foundation.h>
+#import <jsi/jsi.h>
+#import <memory>
+#import <optional>
+#import <stdexcept>
+#import <vector>
+
+using namespace facebook;
+
+static vision::TypedResultDataType getDataType(TypedResultDataType dataType) {
+  switch (dataType) {
+    case TypedResultDataTypeFloat32:
+      return vision::TypedResultDataType::Float32;
+    case TypedResultDataTypeInt32:
+      return vision::TypedResultDataType::Int32;
+  }
+  [NSException raise:NSInvalidArgumentException format:@"Invalid TypedResultDataType: %li", (long)dataType];
+  return vision::TypedResultDataType::Float32;
+}
+
+static void raiseInvalidArgument(const std::exception& exception) {
+  [NSException raise:NSInvalidArgumentException format:@"%s", exception.what()];
+}
+
+@interface TypedResult ()
+- (instancetype)initWithSchema:(std::shared_ptr<vision::TypedResultSchema>)schema;
+@end
+
+@implementation TypedResultSchema {
+  std::shared_ptr<vision::TypedResultSchema> _schema;
+}
+
+- (instancetype)initWithCapacity:(NSInteger)capacity {
+  if (capacity < 0) {
+    [NSException raise:NSInvalidArgumentException format:@"TypedResultSchema: capacity cannot be negative!"];
+  }
+  if (self = [super init]) {
+    _schema = std::make_shared<vision::TypedResultSchema>(static_cast<size_t>(capacity));
+  }
+  return self;
+}
+
+- (void)addArrayWithName:(NSString*)name dataType:(TypedResultDataType)dataType componentsCount:(NSInteger)componentsCount {
+  if (componentsCount < 0) {
+    [NSException raise:NSInvalidArgumentException format:@"TypedResultSchema: componentsCount cannot be negative!"];
+  }
+  try {
+    _schema->addArray(name.UTF8String, getDataType(dataType), static_cast<size_t>(componentsCount));
+  } catch (const std::runtime_error& exception) {
+    raiseInvalidArgument(exception);
+  }
+}
+
+- (void)addTensorWithName:(NSString*)name dataType:(TypedResultDataType)dataType shape:(NSArray<NSNumber*>*)shape {
+  std::vector<size_t> tensorShape;
+  tensorShape.reserve(shape.count);
+  for (NSNumber* dimension in shape) {
+    if (dimension.integerValue < 0) {
+      [NSException raise:NSInvalidArgumentException format:@"TypedResultSchema: Tensor dimensions cannot be negative!"];
+    }
+    tensorShape.push_back(static_cast<size_t>(dimension.integerValue));
+  }
+  try {
+    _schema->addTensor(name.UTF8String, getDataType(dataType), tensorShape);
+  } catch (const std::runtime_error& exception) {
+    raiseInvalidArgument(exception);
+  }
+}
+
+- (TypedResult*)createResult {
+  return [[TypedResult alloc] initWithSchema:_schema];
+}
+
+- (NSInteger)capacity {
+  return static_cast<NSInteger>(_schema->getCapacity());
+}
+
+@end
+
+@implementation TypedResult {
+  std::optional<vision::TypedResult> _result;
+}
+
+- (instancetype)initWithSchema:(std::shared_ptr<vision::TypedResultSchema>)schema {
+  if (self = [super init]) {
+    try {
+      _result.emplace(std::move(schema));
+    } catch (const std::runtime_error& exception) {
+      raiseInvalidArgument(exception);
+    }
+  }
+  return self;
+}
+
+- (uint8_t*)dataForField:(NSString*)field dataType:(TypedResultDataType)dataType {
+  try {
+    size_t index = _result->getSchema().getFieldIndex(field.UTF8String);
+    if (_result->getSchema().getField(index).dataType != getDataType(dataType)) {
+      [NSException raise:NSInvalidArgumentException format:@"TypedResult: Field \"%@\" has a different data type!", field];
+    }
+    return _result->getFieldData(index);
+  } catch (const std::runtime_error& exception) {
+    raiseInvalidArgument(exception);
+    return nullptr;
+  }
+}
+
+- (float*)float32DataForField:(NSString*)field {
+  return reinterpret_cast<float*>([self dataForField:field dataType:TypedResultDataTypeFloat32]);
+}
+
+- (int32_t*)int32DataForField:(NSString*)field {
+  return reinterpret_cast<int32_t*>([self dataForField:field dataType:TypedResultDataTypeInt32]);
+}
+
+- (NSInteger)count {
+  return static_cast<NSInteger>(_result->getCount());
+}
+
+- (void)setCount:(NSInteger)count {
+  if (count < 0) {
+    [NSException raise:NSInvalidArgumentException format:@"TypedResult: count cannot be negative!"];
+  }
+  try {
+    _result->setCount(static_cast<size_t>(count));
+  } catch (const std::runtime_error& exception) {
+    raiseInvalidArgument(exception);
+  }
+}
+
+- (jsi::Value)toJSIValue:(jsi::Runtime&)runtime {
+  return _result->toJSIValue(runtime);
+}
+
+@end
@@ -14,6 +14,7 @@
 
 #import <Foundation/Foundation.h>
 
+#import "NativeState.h"
 #import "VisionCameraProxyDelegate.h"
 #import "WKTJsiWorkletContext.h"
 #import <ReactCommon/CallInvoker.h>
@@ -35,6 +36,13 @@ public:
     return _workletContext->getWorkletRuntime();
   }
 
+  /**
+   * Get the `NativeState` slot with the given name, or `nullptr` if no Frame Processor uses one.
+   */
+  std::shared_ptr<vision::NativeState> getNativeState(const std::string& name) {
+    return _nativeStates->get(name);
+  }
+
 private:
   void setFrameProcessor(jsi::Runtime& runtime, double viewTag, jsi::Function&& frameProcessor);
   void removeFrameProcessor(jsi::Runtime& runtime, double viewTag);
@@ -44,4 +52,5 @@ private:
   std::shared_ptr<RNWorklet::JsiWorkletContext> _workletContext;
   std::shared_ptr<react::CallInvoker> _callInvoker;
   id<VisionCameraProxyDelegate> _delegate;
+  std::shared_ptr<vision::NativeStateRegistry> _nativeStates;
 };
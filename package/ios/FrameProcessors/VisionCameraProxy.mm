@@ -11,10 +11,14 @@
 #import <jsi/jsi.h>
 
 #import "FrameProcessor.h"
+#import "FrameProcessorParallelGroupHostObject.h"
+#import "FrameProcessorPipelineHostObject.h"
 #import "FrameProcessorPluginHostObject.h"
 #import "FrameProcessorPluginRegistry.h"
 #import "JSINSObjectConversion.h"
+#import "NativeStateHostObject.h"
 #import "VisionCameraProxyHolder.h"
+#import "VisionCameraStats.h"
 #import "WKTJsiWorklet.h"
 
 using namespace facebook;
@@ -23,6 +27,7 @@ VisionCameraProxy::VisionCameraProxy(jsi::Runtime& runtime, std::shared_ptr<reac
                                      id<VisionCameraProxyDelegate> delegate) {
   _callInvoker = callInvoker;
   _delegate = delegate;
+  _nativeStates = std::make_shared<vision::NativeStateRegistry>();
 
   NSLog(@"VisionCameraProxy: Creating Worklet Context...");
   auto runOnJS = [callInvoker](std::function<void()>&& f) {
@@ -44,10 +49,15 @@ VisionCameraProxy::~VisionCameraProxy() {
 }
 
 std::vector<jsi::PropNameID> VisionCameraProxy::getPropertyNames(jsi::Runtime& runtime) {
-  return jsi::PropNameID::names(runtime, "setFrameProcessor", "removeFrameProcessor", "initFrameProcessorPlugin", "workletContext");
+  return jsi::PropNameID::names(runtime, "setFrameProcessor", "removeFrameProcessor", "initFrameProcessorPlugin", "createPipeline",
+                                "createParallelGroup", "createNativeState", "getStats", "workletContext");
 }
 
 void VisionCameraProxy::setFrameProcessor(jsi::Runtime& runtime, double jsViewTag, jsi::Function&& function) {
+  // The Frame Processor owns the NativeState slots it captures, they have to exist before its first Frame arrives.
+  auto nativeStateNames = vision::NativeStateHostObject::getCapturedNames(runtime, function);
+  _nativeStates->setFrameProcessorStates(static_cast<int>(jsViewTag), nativeStateNames);
+
   auto sharedFunction = std::make_shared<jsi::Function>(std::move(function));
   auto worklet = std::make_shared<RNWorklet::JsiWorklet>(runtime, sharedFunction);
 
@@ -60,6 +70,7 @@ void VisionCameraProxy::setFrameProcessor(jsi::Runtime& runtime, double jsViewTa
 void VisionCameraProxy::removeFrameProcessor(jsi::Runtime& runtime, double jsViewTag) {
   NSNumber* viewTag = [NSNumber numberWithDouble:jsViewTag];
   [_delegate removeFrameProcessorForView:viewTag];
+  _nativeStates->removeFrameProcessorStates(static_cast<int>(jsViewTag));
 }
 
 jsi::Value VisionCameraProxy::initFrameProcessorPlugin(jsi::Runtime& runtime, const jsi::String& name, const jsi::Object& options) {
@@ -74,7 +85,7 @@ jsi::Value VisionCameraProxy::initFrameProcessorPlugin(jsi::Runtime& runtime, co
       return jsi::Value::undefined();
     }
 
-    auto pluginHostObject = std::make_shared<FrameProcessorPluginHostObject>(plugin, _callInvoker);
+    auto pluginHostObject = std::make_shared<FrameProcessorPluginHostObject>(plugin, nameString, _callInvoker);
     return jsi::Object::createFromHostObject(runtime, pluginHostObject);
   } @catch (NSException* exception) {
     // Objective-C plugin threw an error when initializing.
@@ -120,6 +131,48 @@ jsi::Value VisionCameraProxy::get(jsi::Runtime& runtime, const jsi::PropNameID&
 
           return this->initFrameProcessorPlugin(runtime, pluginName, options);
         });
+  } else if (name == "createPipeline") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createPipeline"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1) {
+            throw jsi::JSError(runtime, "createPipeline: First argument needs to be an array of Frame Processor Plugins!");
+          }
+          auto pipeline = FrameProcessorPipelineHostObject::create(runtime, arguments[0]);
+          return jsi::Object::createFromHostObject(runtime, pipeline);
+        });
+  } else if (name == "createParallelGroup") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createParallelGroup"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1) {
+            throw jsi::JSError(runtime, "createParallelGroup: First argument needs to be an array of Frame Processor Plugins!");
+          }
+          auto group = FrameProcessorParallelGroupHostObject::create(runtime, arguments[0]);
+          return jsi::Object::createFromHostObject(runtime, group);
+        });
+  } else if (name == "createNativeState") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "createNativeState"), 1,
+        [this](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          if (count < 1 || !arguments[0].isString()) {
+            throw jsi::JSError(runtime, "createNativeState: First argument needs to be a string (name)!");
+          }
+          auto name = arguments[0].asString(runtime).utf8(runtime);
+          auto handle = std::make_shared<vision::NativeStateHostObject>(_nativeStates, name);
+          return jsi::Object::createFromHostObject(runtime, handle);
+        });
+  } else if (name == "getStats") {
+    return jsi::Function::createFromHostFunction(
+        runtime, jsi::PropNameID::forUtf8(runtime, "getStats"), 1,
+        [](jsi::Runtime& runtime, const jsi::Value& thisValue, const jsi::Value* arguments, size_t count) -> jsi::Value {
+          bool resetTimings = false;
+          if (count > 0 && arguments[0].isObject()) {
+            jsi::Value resetTimingsValue = arguments[0].getObject(runtime).getProperty(runtime, "resetTimings");
+            resetTimings = resetTimingsValue.isBool() && resetTimingsValue.getBool();
+          }
+          return vision::VisionCameraStats::getStats(runtime, resetTimings);
+        });
   } else if (name == "workletContext") {
     return jsi::Object::createFromHostObject(runtime, _workletContext);
   }
@@ -25,6 +25,12 @@ NS_ASSUME_NONNULL_BEGIN
 
 #ifdef __cplusplus
 - (VisionCameraProxy*)proxy;
+
+/**
+ Get the native state slot with the given name, which JS created with `VisionCameraProxy.createNativeState(name)`.
+ Returns `nullptr` if no Frame Processor that captures a handle with this name is set (anymore).
+ */
+- (std::shared_ptr<vision::NativeState>)getNativeState:(NSString*)name;
 #endif
 
 @end
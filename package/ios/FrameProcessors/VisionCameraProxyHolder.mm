@@ -24,4 +24,8 @@
   return _proxy;
 }
 
+- (std::shared_ptr<vision::NativeState>)getNativeState:(NSString*)name {
+  return _proxy->getNativeState(name.UTF8String);
+}
+
 @end
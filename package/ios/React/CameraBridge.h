@@ -20,6 +20,7 @@
 #import "FrameProcessorPlugin.h"
 #import "FrameProcessorPluginRegistry.h"
 #import "SharedArray.h"
+#import "TypedResultSchema.h"
 #import "VisionCameraInstaller.h"
 #import "VisionCameraProxyDelegate.h"
 #import "VisionCameraProxyHolder.h"
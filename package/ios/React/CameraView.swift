@@ -373,7 +373,9 @@ public final class CameraView: UIView, CameraSessionDelegate, PreviewViewDelegat
         let frame = Frame(buffer: sampleBuffer,
                           orientation: orientation.imageOrientation,
                           isMirrored: isMirrored)
-        frameProcessor.call(frame)
+        // The Camera never delivers Frames slower than its max frame duration, longer gaps are dropped Frames.
+        let maxFrameDuration = cameraSession.videoDeviceInput?.device.activeVideoMaxFrameDuration ?? .invalid
+        frameProcessor.call(frame, maxFrameDuration: maxFrameDuration)
       }
     #endif
   }
@@ -30,7 +30,10 @@ import Foundation
 
     func removeFrameProcessor(forView viewTag: NSNumber) {
       DispatchQueue.main.async {
-        let view = self.getCameraView(withTag: viewTag)
+        // The view is already gone if the Camera was unmounted
+        guard let view = self.bridge.uiManager.view(forReactTag: viewTag) as? CameraView else {
+          return
+        }
         view.frameProcessor = nil
       }
     }
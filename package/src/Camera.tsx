@@ -9,6 +9,7 @@ import type { PhotoFile, TakePhotoOptions } from './types/PhotoFile'
 import type { Point } from './types/Point'
 import type { RecordVideoOptions, VideoFile } from './types/VideoFile'
 import { VisionCameraProxy } from './frame-processors/VisionCameraProxy'
+import { clearAsyncRunners } from './frame-processors/runAsync'
 import { CameraDevices } from './CameraDevices'
 import type { EmitterSubscription, NativeSyntheticEvent, NativeMethods } from 'react-native'
 import type { TakeSnapshotOptions } from './types/Snapshot'
@@ -583,6 +584,8 @@ export class Camera extends React.PureComponent<CameraProps, CameraState> {
 
   private unsetFrameProcessor(): void {
     VisionCameraProxy.removeFrameProcessor(this.handle)
+    // Calls that still wait for an async context would otherwise hold on to their Frames
+    clearAsyncRunners()
   }
 
   private onViewReady(): void {
@@ -621,6 +624,12 @@ export class Camera extends React.PureComponent<CameraProps, CameraState> {
       this.lastFrameProcessor = frameProcessor?.frameProcessor
     }
   }
+
+  /** @internal */
+  componentWillUnmount(): void {
+    // Releases the native state slots owned by the Frame Processor
+    if (this.isNativeViewMounted && this.lastFrameProcessor != null) this.unsetFrameProcessor()
+  }
   //#endregion
 
   /** @internal */
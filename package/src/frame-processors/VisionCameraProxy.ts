@@ -3,9 +3,33 @@ import { CameraModule } from '../NativeCameraModule'
 import type { Frame } from '../types/Frame'
 import { FrameProcessorsUnavailableError } from './FrameProcessorsUnavailableError'
 
-type BasicParameterType = string | number | boolean | undefined | ArrayBuffer
+type NumericArrayType = Float32Array | Float64Array | Int32Array | Int16Array | Uint8Array
+type BasicParameterType = string | number | boolean | undefined | ArrayBuffer | NumericArrayType
 type ParameterType = BasicParameterType | BasicParameterType[] | Record<string, BasicParameterType | undefined>
 
+/**
+ * The result of a Frame Processor Plugin that returned a native `TypedResult`.
+ *
+ * All fields are views into one shared `ArrayBuffer`, Array fields contain `count` rows.
+ * @example
+ * ```ts
+ * const result = plugin.call(frame) as TypedResult<'landmarks'>
+ * for (let i = 0; i < result.count; i++) {
+ *   const x = result.landmarks[i * 2]
+ *   const y = result.landmarks[i * 2 + 1]
+ * }
+ * ```
+ */
+export type TypedResult<TFields extends string = string> = { count: number } & Record<TFields, Float32Array | Int32Array>
+
+/**
+ * Options that have been converted to their native representation once with
+ * {@linkcode FrameProcessorPlugin.prepare | FrameProcessorPlugin.prepare(..)}.
+ */
+export interface PreparedPluginOptions {
+  readonly __preparedPluginOptions: unique symbol
+}
+
 /**
  * An initialized native instance of a FrameProcessorPlugin.
  * All memory allocated by this plugin will be deleted once this value goes out of scope.
@@ -14,10 +38,216 @@ export interface FrameProcessorPlugin {
   /**
    * Call the native Frame Processor Plugin with the given Frame and options.
    * @param frame The Frame from the Frame Processor.
-   * @param options (optional) Additional options. Options will be converted to a native dictionary
-   * @returns (optional) A value returned from the native Frame Processor Plugin (or undefined)
+   * @param options (optional) Additional options. Options will be converted to a native (read-only) dictionary,
+   * which is reused across calls as long as the options do not change. Passing the same options object again is the
+   * fastest, but properties added to it after the first call are not picked up - pass a new object instead.
+   * @returns (optional) A value returned from the native Frame Processor Plugin (or undefined), or a {@linkcode TypedResult}
+   */
+  call(frame: Frame, options?: Record<string, ParameterType> | PreparedPluginOptions): ParameterType | TypedResult
+  /**
+   * Converts the given options to a native dictionary once, so they can be passed to every
+   * {@linkcode FrameProcessorPlugin.call | call(..)} without being compared or converted again.
+   * @example
+   * ```ts
+   * const options = plugin.prepare({ model: 'fast' })
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const faces = plugin.call(frame, options)
+   * }, [options])
+   * ```
+   */
+  prepare(options: Record<string, ParameterType>): PreparedPluginOptions
+}
+
+/**
+ * A stage of a {@linkcode FrameProcessorPipeline}: either a Plugin, or a Plugin with constant options.
+ */
+export type FrameProcessorPipelineStage =
+  | FrameProcessorPlugin
+  | {
+      plugin: FrameProcessorPlugin
+      options?: Record<string, ParameterType> | PreparedPluginOptions
+    }
+
+/**
+ * A chain of native Frame Processor Plugins that runs on a Frame in a single native call.
+ * Created with {@linkcode TVisionCameraProxy.createPipeline | VisionCameraProxy.createPipeline(..)}.
+ */
+export interface FrameProcessorPipeline {
+  /**
+   * Runs all stages of the pipeline on the given Frame, and returns the result of the last stage.
+   * @param frame The Frame from the Frame Processor.
+   */
+  call(frame: Frame): ParameterType | TypedResult
+}
+
+/**
+ * A group of independent native Frame Processor Plugins that run on a Frame in parallel, on native worker Threads.
+ * Created with {@linkcode TVisionCameraProxy.createParallelGroup | VisionCameraProxy.createParallelGroup(..)}.
+ */
+export interface FrameProcessorParallelGroup {
+  /**
+   * Runs all Plugins of the group on the given Frame in parallel, waits until all of them are done, and returns their results
+   * in the same order as the Plugins.
+   * @param frame The Frame from the Frame Processor.
+   */
+  call(frame: Frame): (ParameterType | TypedResult)[]
+}
+
+/**
+ * An opaque handle to a named slot of native state that Frame Processor Plugins keep across Frames.
+ * Created with {@linkcode TVisionCameraProxy.createNativeState | VisionCameraProxy.createNativeState(..)}.
+ *
+ * The native state itself is never converted to JS. It lives as long as a Frame Processor that captures this handle is
+ * set on a Camera, and is released once that Frame Processor is removed or replaced by one that does not capture it.
+ */
+export interface NativeState {
+  /**
+   * The name native Plugins look this slot up by.
+   */
+  readonly name: string
+  /**
+   * Whether a native Plugin has stored a value in this slot. Always `false` while no Frame Processor captures this handle.
+   */
+  readonly hasValue: boolean
+  /**
+   * Clears the native value of this slot, e.g. to restart tracking.
+   */
+  reset(): void
+}
+
+/**
+ * Statistics of the pool that backs `ArrayBuffer`s returned by {@linkcode Frame.toArrayBuffer | Frame.toArrayBuffer()}.
+ */
+export interface ArrayBufferPoolStats {
+  /**
+   * The number of buffers that could be reused from the pool.
+   */
+  hits: number
+  /**
+   * The number of buffers that had to be newly allocated.
+   */
+  misses: number
+  /**
+   * The total number of bytes currently allocated by the pool, including buffers that are in use.
+   * The pool keeps at most about 68 MB of free buffers (two 4K RGBA Frames), and frees the least recently released ones above that.
+   */
+  bytesResident: number
+  /**
+   * The number of bytes currently referenced from JS.
+   */
+  bytesInUse: number
+}
+
+/**
+ * Statistics of the conversion of options passed to {@linkcode FrameProcessorPlugin.call | FrameProcessorPlugin.call(..)}.
+ */
+export interface PluginOptionsStats {
+  /**
+   * The number of options objects that had to be converted to a native dictionary.
+   * With constant options, this stays constant in steady state.
+   */
+  conversions: number
+  /**
+   * The number of calls that reused a previously converted native dictionary.
+   */
+  cacheHits: number
+}
+
+/**
+ * A distribution of durations, in milliseconds.
+ * Percentiles are accurate to about 12.5%.
+ */
+export interface TimingStats {
+  /**
+   * The number of recorded durations.
+   */
+  count: number
+  mean: number
+  p50: number
+  p90: number
+  p99: number
+  max: number
+}
+
+/**
+ * Timings of the native Frame Processor hot paths.
+ */
+export interface FrameProcessorTimingStats {
+  /**
+   * The time the Frame Processor takes per Frame, including all Plugin calls.
+   */
+  frameProcessor: TimingStats
+  /**
+   * The time it takes to convert (or look up) the options passed to Plugins.
+   */
+  argumentConversion: TimingStats
+  /**
+   * The time it takes to convert the results of Plugins to JS.
+   */
+  resultConversion: TimingStats
+  /**
+   * The time the native `callback` of every Plugin takes, by the name it was registered with.
+   */
+  plugins: Record<string, TimingStats>
+}
+
+export interface FrameStats {
+  /**
+   * The number of Frames that were passed to the Frame Processor.
+   */
+  processed: number
+  /**
+   * The number of Frames the Camera produced, but that were dropped before they reached the Frame Processor because it was still busy
+   * with a previous Frame. Detected from gaps in the Frames' sensor timestamps.
+   */
+  dropped: number
+  /**
+   * The time between a Frame's sensor timestamp and the start of the Frame Processor. The time the Frame Processor then takes is
+   * `timings.frameProcessor`.
+   */
+  queueingDelay: TimingStats
+}
+
+export interface FrameMemoryStats {
+  /**
+   * The most memory a single Frame drew from the native per-Frame scratch arena, in bytes.
+   */
+  arenaPeakBytes: number
+  /**
+   * The memory the per-Frame scratch arena holds on to between Frames, in bytes.
+   */
+  arenaReservedBytes: number
+  /**
+   * The most the JS heap grew during a single Frame Processor call, in bytes. Only reported on Hermes.
+   * The heap size is sampled on every 16th Frame, so this is the peak of the sampled Frames.
+   */
+  heapGrowthPeakBytes: number
+  /**
+   * How much the JS heap grew per Frame Processor call on average, in bytes. Only reported on Hermes.
+   * The heap size is sampled on every 16th Frame.
+   */
+  heapGrowthMeanBytes: number
+}
+
+/**
+ * Runtime statistics of the native Frame Processor subsystems.
+ */
+export interface VisionCameraStats {
+  arrayBufferPool: ArrayBufferPoolStats
+  pluginOptions: PluginOptionsStats
+  timings: FrameProcessorTimingStats
+  frames: FrameStats
+  memory: FrameMemoryStats
+}
+
+export interface GetStatsOptions {
+  /**
+   * If `true`, all timings (including `frames.queueingDelay`) and memory peaks are cleared after reading them, so the next call
+   * only contains the Frames in between.
+   * @default false
    */
-  call(frame: Frame, options?: Record<string, ParameterType>): ParameterType
+  resetTimings?: boolean
 }
 
 interface TVisionCameraProxy {
@@ -41,6 +271,72 @@ interface TVisionCameraProxy {
    * ```
    */
   initFrameProcessorPlugin(name: string, options: Record<string, ParameterType>): FrameProcessorPlugin | undefined
+  /**
+   * Creates a pipeline that runs the given native Frame Processor Plugins one after another on a Frame in a single native call.
+   *
+   * The options of every stage are converted to native once when the pipeline is created. Every stage after the first one
+   * receives the native result of the previous stage as `previousResult` in its options, and only the result of the last
+   * stage is converted to JS - so intermediate results never cross the JS boundary.
+   * @param stages The Plugins to run, in order. Use `{ plugin, options }` to pass constant options to a Plugin.
+   * @example
+   * ```ts
+   * const pipeline = VisionCameraProxy.createPipeline([{ plugin: detector, options: { model: 'fast' } }, pose, classifier])
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const classification = pipeline.call(frame)
+   * }, [pipeline])
+   * ```
+   */
+  createPipeline(stages: FrameProcessorPipelineStage[]): FrameProcessorPipeline
+  /**
+   * Creates a group of independent native Frame Processor Plugins that run on a Frame in parallel, on a pool of native
+   * worker Threads. `call(frame)` blocks until all Plugins are done, so a Frame takes as long as the slowest Plugin instead
+   * of the sum of all Plugins.
+   *
+   * The Frame is kept alive while the Plugins are running, and the options of every Plugin are converted to native once
+   * when the group is created. Every Plugin instance can only be used once per group, and its native `callback` must not
+   * depend on running on the Frame Processor Thread.
+   * @param stages The Plugins to run. Use `{ plugin, options }` to pass constant options to a Plugin.
+   * @example
+   * ```ts
+   * const group = VisionCameraProxy.createParallelGroup([barcodeScanner, { plugin: faceDetector, options: { landmarks: true } }])
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const [barcodes, faces] = group.call(frame)
+   * }, [group])
+   * ```
+   */
+  createParallelGroup(stages: FrameProcessorPipelineStage[]): FrameProcessorParallelGroup
+  /**
+   * Creates a named slot of native state that Frame Processor Plugins can keep across Frames, such as an object tracker.
+   *
+   * Native Plugins look the slot up by its name through the `VisionCameraProxy` they were initialized with, so their
+   * state never has to be passed through JS on every call. The slot is owned by the Frame Processors that capture the
+   * returned handle: it is created when the first of them is set on a Camera, and released once none of them is set
+   * anymore. All handles with the same name refer to the same slot.
+   * @param name The name of the slot, as expected by the native Plugin.
+   * @example
+   * ```ts
+   * const tracker = useNativeState('objectTracker')
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   if (!tracker.hasValue) console.log('Started tracking objects!')
+   *   const objects = trackObjects(frame)
+   * }, [tracker])
+   * ```
+   */
+  createNativeState(name: string): NativeState
+  /**
+   * Get runtime statistics of the native Frame Processor subsystems, e.g. to debug memory usage or to find
+   * which Plugin exceeds the Frame budget.
+   * @example
+   * ```ts
+   * const stats = VisionCameraProxy.getStats()
+   * console.log(`ArrayBuffer pool: ${stats.arrayBufferPool.bytesResident} bytes resident`)
+   * console.log(`Frame Processor p99: ${stats.timings.frameProcessor.p99}ms`)
+   * ```
+   */
+  getStats(options?: GetStatsOptions): VisionCameraStats
   /**
    * Get the Frame Processor Runtime Worklet Context.
    *
@@ -81,6 +377,18 @@ try {
     setFrameProcessor: () => {
       throw new FrameProcessorsUnavailableError(e)
     },
+    createPipeline: () => {
+      throw new FrameProcessorsUnavailableError(e)
+    },
+    createParallelGroup: () => {
+      throw new FrameProcessorsUnavailableError(e)
+    },
+    createNativeState: () => {
+      throw new FrameProcessorsUnavailableError(e)
+    },
+    getStats: () => {
+      throw new FrameProcessorsUnavailableError(e)
+    },
     workletContext: undefined,
   }
 }
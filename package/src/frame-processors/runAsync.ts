@@ -1,54 +1,374 @@
 import { WorkletsProxy } from '../dependencies/WorkletsProxy'
 import type { Frame, FrameInternal } from '../types/Frame'
 import { FrameProcessorsUnavailableError } from './FrameProcessorsUnavailableError'
+import { VisionCameraProxy } from './VisionCameraProxy'
 import { throwErrorOnJS } from './throwErrorOnJS'
 
 /**
- * A synchronized Shared Value to indicate whether the async context is currently executing
+ * What an {@linkcode AsyncRunner} does with a call while all of its async contexts are busy.
+ *
+ * - `'drop-new'`: Drop the new call. This is the behaviour of {@linkcode runAsync}.
+ * - `'drop-oldest'`: Queue the call, and drop the oldest queued call if the queue is full. Queued calls run in order.
+ * - `'latest-only'`: Queue the call, and drop the oldest queued call if the queue is full. Once a context is free,
+ * the newest call runs first - so results are always as fresh as possible.
  */
-let isAsyncContextBusy: { value: boolean }
+export type AsyncDropPolicy = 'drop-new' | 'drop-oldest' | 'latest-only'
+
+export interface AsyncRunnerOptions {
+  /**
+   * The number of async contexts (each with its own Thread) that can run calls in parallel.
+   * @default 1
+   */
+  contexts?: number
+  /**
+   * What to do with a call while all async contexts are busy.
+   * @default 'drop-new'
+   */
+  policy?: AsyncDropPolicy
+  /**
+   * The maximum number of calls that wait for a free context with the `'drop-oldest'` and `'latest-only'` policies.
+   *
+   * Every queued call keeps its Frame alive, and Cameras only have a few buffers - so keep this small.
+   * @default 1
+   */
+  queueDepth?: number
+}
+
+export interface AsyncContextStats {
+  /**
+   * Whether this context is currently running a call.
+   */
+  isBusy: boolean
+  /**
+   * The number of calls this context finished running.
+   */
+  completed: number
+  /**
+   * The number of calls that currently wait for this context.
+   */
+  queued: number
+  /**
+   * The number of calls that were dropped because this context was busy.
+   */
+  dropped: number
+}
+
+export interface AsyncRunnerStats {
+  contexts: AsyncContextStats[]
+  /**
+   * The number of calls that currently wait for a free context, summed over all contexts.
+   */
+  queued: number
+  /**
+   * The number of calls that were handed to a context.
+   */
+  dispatched: number
+  /**
+   * The number of calls that were dropped because all contexts were busy, summed over all contexts.
+   */
+  dropped: number
+}
+
+export interface AsyncRunner {
+  /**
+   * Runs the given {@linkcode func} asynchronously on one of the runner's async contexts,
+   * or queues/drops it according to the runner's {@linkcode AsyncDropPolicy}.
+   * @worklet
+   */
+  runAsync(frame: Frame, func: () => void): void
+  /**
+   * Get the busy, queue and drop counters of this runner, e.g. to size it to the device.
+   * This can be called from JS or from a worklet.
+   */
+  getStats(): AsyncRunnerStats
+  /**
+   * Drops all queued calls and releases their Frames.
+   *
+   * This happens automatically when a Camera's Frame Processor is removed.
+   * This can be called from JS or from a worklet.
+   */
+  clear(): void
+}
+
+interface AsyncCall {
+  frame: Frame
+  func: () => void
+}
+
+interface AsyncContext {
+  isBusy: { value: boolean }
+  completed: { value: number }
+  queued: { value: number }
+  dropped: { value: number }
+  run: (frame: Frame, func: () => void) => void
+}
+
 /**
- * Runs the given function on the async context, and sets {@linkcode isAsyncContextBusy} to false after it finished executing.
+ * The part of a runner that lives on the Frame Processor Thread.
+ * It is only ever touched from the Frame Processor Thread, so never concurrently.
  */
-let runOnAsyncContext: (frame: Frame, func: () => void) => void
+interface AsyncRunnerState {
+  // The calls waiting for each context
+  queues: AsyncCall[][]
+  // Hands the next queued call to the given context, if it is free
+  dispatch: (contextIndex: number) => void
+  // Drops all queued calls
+  clear: () => void
+}
+
+declare global {
+  // eslint-disable-next-line no-var
+  var __visionCameraAsyncRunners: Record<number, AsyncRunnerState | undefined> | undefined
+}
 
-try {
-  const Worklets = WorkletsProxy.Worklets
-  isAsyncContextBusy = Worklets.createSharedValue(false)
+let nextRunnerId = 0
+const runners: AsyncRunner[] = []
 
-  const asyncContext = Worklets.createContext('VisionCamera.async')
-  runOnAsyncContext = asyncContext.createRunAsync((frame: Frame, func: () => void) => {
+/**
+ * Drops the queued calls of all runners and releases their Frames.
+ * @internal
+ */
+export function clearAsyncRunners(): void {
+  for (const runner of runners) runner.clear()
+}
+
+/**
+ * Creates a pool of async contexts that run expensive work (e.g. a heavy ML model) outside of the Frame Processor,
+ * in parallel on multiple Threads.
+ *
+ * {@linkcode runAsync} only has a single async context, so with a model that takes 500ms it can only process 2 FPS.
+ * A runner with 4 contexts processes up to 8 FPS on a device with enough cores.
+ *
+ * Every context has its own queue. A call goes to a free context, or waits in the shortest queue. As soon as a
+ * context finished a call, it hands the next call of its queue to itself on the Frame Processor Thread, so queued
+ * calls never wait for the next Frame.
+ *
+ * Create the runner once, outside of a component.
+ * @example
+ *
+ * ```ts
+ * const runner = createAsyncRunner({ contexts: 3, policy: 'latest-only', queueDepth: 1 })
+ *
+ * const frameProcessor = useFrameProcessor((frame) => {
+ *   'worklet'
+ *   runner.runAsync(frame, () => {
+ *     'worklet'
+ *     const faces = detectFaces(frame)
+ *     console.log(`Detected ${faces.length} faces!`)
+ *   })
+ * }, [])
+ * ```
+ */
+export function createAsyncRunner(options: AsyncRunnerOptions = {}): AsyncRunner {
+  const contextsCount = options.contexts ?? 1
+  const policy = options.policy ?? 'drop-new'
+  const queueDepth = policy === 'drop-new' ? 0 : options.queueDepth ?? 1
+  if (!Number.isInteger(contextsCount) || contextsCount < 1)
+    throw new Error(`createAsyncRunner: Invalid contexts count (${contextsCount})!`)
+  if (!Number.isInteger(queueDepth) || queueDepth < 0) throw new Error(`createAsyncRunner: Invalid queue depth (${queueDepth})!`)
+
+  const runnerId = nextRunnerId++
+
+  let contexts: AsyncContext[]
+  let dispatchedCount: { value: number }
+  let dispatchOnFrameProcessorThread: ((contextIndex: number) => void) | undefined
+  let clearOnFrameProcessorThread: (() => void) | undefined
+
+  try {
+    const Worklets = WorkletsProxy.Worklets
+    contexts = []
+    dispatchedCount = Worklets.createSharedValue(0)
+
+    // The runner's state is looked up by its ID, so these don't capture the state (and its Frames) themselves
+    const frameProcessorContext = VisionCameraProxy.workletContext
+    dispatchOnFrameProcessorThread = frameProcessorContext?.createRunAsync((contextIndex: number) => {
+      'worklet'
+      global.__visionCameraAsyncRunners?.[runnerId]?.dispatch(contextIndex)
+    })
+    clearOnFrameProcessorThread = frameProcessorContext?.createRunAsync(() => {
+      'worklet'
+      global.__visionCameraAsyncRunners?.[runnerId]?.clear()
+    })
+
+    for (let i = 0; i < contextsCount; i++) {
+      // Every flag and counter is only ever written by one Thread at a time
+      const contextIndex = i
+      const isBusy = Worklets.createSharedValue(false)
+      const completed = Worklets.createSharedValue(0)
+      const queued = Worklets.createSharedValue(0)
+      const dropped = Worklets.createSharedValue(0)
+      const contextName = runnerId === 0 && contextsCount === 1 ? 'VisionCamera.async' : `VisionCamera.async.${runnerId}.${i}`
+      const context = Worklets.createContext(contextName)
+      const dispatchNext = dispatchOnFrameProcessorThread
+      const run = context.createRunAsync((frame: Frame, func: () => void) => {
+        'worklet'
+        try {
+          // Call long-running function
+          func()
+        } catch (e) {
+          // Re-throw error on JS Thread
+          throwErrorOnJS(e)
+        } finally {
+          // Potentially delete Frame if we were the last ref
+          const internal = frame as FrameInternal
+          internal.decrementRefCount()
+
+          completed.value = completed.value + 1
+          // free up async context again, new calls can be made
+          isBusy.value = false
+          // Hand the next queued call to this context
+          dispatchNext?.(contextIndex)
+        }
+      })
+      contexts.push({ isBusy: isBusy, completed: completed, queued: queued, dropped: dropped, run: run })
+    }
+  } catch (e) {
+    // react-native-worklets-core is not installed!
+    // Just use dummy implementations that will throw when the user tries to use Frame Processors.
+    return {
+      runAsync: () => {
+        throw new FrameProcessorsUnavailableError(e)
+      },
+      getStats: () => {
+        throw new FrameProcessorsUnavailableError(e)
+      },
+      clear: () => {
+        // Nothing can be queued without Frame Processors.
+      },
+    }
+  }
+
+  const drop = (contextIndex: number, call: AsyncCall): void => {
+    'worklet'
+    // Potentially delete Frame if we were the last ref
+    const internal = call.frame as FrameInternal
+    internal.decrementRefCount()
+    const context = contexts[contextIndex]
+    if (context != null) context.dropped.value = context.dropped.value + 1
+  }
+
+  const dispatch = (contextIndex: number): void => {
+    'worklet'
+    const context = contexts[contextIndex]
+    const queue = global.__visionCameraAsyncRunners?.[runnerId]?.queues[contextIndex]
+    if (context == null || queue == null || context.isBusy.value) return
+
+    // The oldest call first, or the newest call first
+    const call = policy === 'latest-only' ? queue.pop() : queue.shift()
+    context.queued.value = queue.length
+    if (call == null) return
+
+    context.isBusy.value = true
+    dispatchedCount.value = dispatchedCount.value + 1
+    // Call in separate background context
+    context.run(call.frame, call.func)
+  }
+
+  const clear = (): void => {
+    'worklet'
+    const queues = global.__visionCameraAsyncRunners?.[runnerId]?.queues
+    if (queues == null) return
+    queues.forEach((queue, contextIndex) => {
+      for (let call = queue.shift(); call != null; call = queue.shift()) drop(contextIndex, call)
+    })
+    for (const context of contexts) context.queued.value = 0
+  }
+
+  const getState = (): AsyncRunnerState => {
+    'worklet'
+    if (global.__visionCameraAsyncRunners == null) global.__visionCameraAsyncRunners = {}
+    let state = global.__visionCameraAsyncRunners[runnerId]
+    if (state == null) {
+      state = { queues: contexts.map(() => []), dispatch: dispatch, clear: clear }
+      global.__visionCameraAsyncRunners[runnerId] = state
+    }
+    return state
+  }
+
+  const getTargetContextIndex = (queues: AsyncCall[][]): number => {
+    'worklet'
+    // A free context, or the context with the fewest waiting calls
+    const freeIndex = contexts.findIndex((context) => !context.isBusy.value)
+    if (freeIndex !== -1) return freeIndex
+    let target = 0
+    queues.forEach((queue, i) => {
+      if (queue.length < (queues[target]?.length ?? 0)) target = i
+    })
+    return target
+  }
+
+  const runAsyncOnRunner = (frame: Frame, func: () => void): void => {
     'worklet'
-    try {
-      // Call long-running function
-      func()
-    } catch (e) {
-      // Re-throw error on JS Thread
-      throwErrorOnJS(e)
-    } finally {
-      // Potentially delete Frame if we were the last ref
-      const internal = frame as FrameInternal
-      internal.decrementRefCount()
-
-      // free up async context again, new calls can be made
-      isAsyncContextBusy.value = false
+    const state = getState()
+    const contextIndex = getTargetContextIndex(state.queues)
+    const context = contexts[contextIndex]
+    const queue = state.queues[contextIndex]
+    if (context == null || queue == null) return
+
+    if (queueDepth === 0 && context.isBusy.value) {
+      // all async contexts are currently busy, we cannot schedule new work in time.
+      // drop this frame/runAsync call.
+      context.dropped.value = context.dropped.value + 1
+      return
+    }
+
+    // Increment ref count by one, this call either runs or waits in the queue now
+    const internal = frame as FrameInternal
+    internal.incrementRefCount()
+    queue.push({ frame: frame, func: func })
+    dispatch(contextIndex)
+
+    // Drop the oldest calls that no longer fit into the queue
+    while (queue.length > queueDepth) {
+      const call = queue.shift()
+      if (call != null) drop(contextIndex, call)
     }
-  })
-} catch (e) {
-  // react-native-worklets-core is not installed!
-  // Just use dummy implementations that will throw when the user tries to use Frame Processors.
-  isAsyncContextBusy = { value: false }
-  runOnAsyncContext = () => {
-    throw new FrameProcessorsUnavailableError(e)
+    context.queued.value = queue.length
+  }
+
+  const getStats = (): AsyncRunnerStats => {
+    'worklet'
+    const contextStats = contexts.map((context) => ({
+      isBusy: context.isBusy.value,
+      completed: context.completed.value,
+      queued: context.queued.value,
+      dropped: context.dropped.value,
+    }))
+    return {
+      contexts: contextStats,
+      queued: contextStats.reduce((sum, context) => sum + context.queued, 0),
+      dispatched: dispatchedCount.value,
+      dropped: contextStats.reduce((sum, context) => sum + context.dropped, 0),
+    }
+  }
+
+  const clearRunner = (): void => {
+    'worklet'
+    // The queues only live on the Frame Processor Thread
+    clearOnFrameProcessorThread?.()
   }
+
+  const runner: AsyncRunner = {
+    runAsync: runAsyncOnRunner,
+    getStats: getStats,
+    clear: clearRunner,
+  }
+  runners.push(runner)
+  return runner
 }
 
+/**
+ * The runner behind {@linkcode runAsync}, with a single async context that drops new calls while it is busy.
+ */
+const defaultRunner = createAsyncRunner()
+
 /**
  * Runs the given {@linkcode func} asynchronously on a separate thread,
  * allowing the Frame Processor to continue executing without dropping a Frame.
  *
  * Only one {@linkcode runAsync} call will execute at the same time,
  * so {@linkcode runAsync} is **not parallel**, **but asynchronous**.
+ * To run calls in parallel, or to queue calls instead of dropping them, use {@linkcode createAsyncRunner}.
  *
  *
  * For example, if your Camera is running at 60 FPS (16ms per frame), and a
@@ -82,19 +402,5 @@ try {
  */
 export function runAsync(frame: Frame, func: () => void): void {
   'worklet'
-
-  if (isAsyncContextBusy.value) {
-    // async context is currently busy, we cannot schedule new work in time.
-    // drop this frame/runAsync call.
-    return
-  }
-
-  // Increment ref count by one
-  const internal = frame as FrameInternal
-  internal.incrementRefCount()
-
-  isAsyncContextBusy.value = true
-
-  // Call in separate background context
-  runOnAsyncContext(frame, func)
+  defaultRunner.runAsync(frame, func)
 }
@@ -0,0 +1,25 @@
+import { useMemo } from 'react'
+import type { NativeState } from '../frame-processors/VisionCameraProxy'
+import { VisionCameraProxy } from '../frame-processors/VisionCameraProxy'
+
+/**
+ * Creates a named slot of native state that Frame Processor Plugins keep across Frames, such as an object tracker.
+ *
+ * The slot lives as long as a Frame Processor that captures the returned handle is set on the Camera.
+ * See {@linkcode VisionCameraProxy.createNativeState | VisionCameraProxy.createNativeState(..)}.
+ *
+ * @param name The name of the slot, as expected by the native Plugin.
+ * @returns An opaque handle to the slot.
+ * @example
+ * ```tsx
+ * const tracker = useNativeState('objectTracker')
+ * const frameProcessor = useFrameProcessor((frame) => {
+ *   'worklet'
+ *   if (!tracker.hasValue) console.log('Started tracking objects!')
+ *   const objects = trackObjects(frame)
+ * }, [tracker])
+ * ```
+ */
+export function useNativeState(name: string): NativeState {
+  return useMemo(() => VisionCameraProxy.createNativeState(name), [name])
+}
@@ -0,0 +1,30 @@
+import { useEffect, useState } from 'react'
+import type { VisionCameraStats } from '../frame-processors/VisionCameraProxy'
+import { VisionCameraProxy } from '../frame-processors/VisionCameraProxy'
+
+/**
+ * Periodically polls the runtime statistics of the native Frame Processor subsystems.
+ *
+ * Timings are reset on every poll, so they only contain the Frames of the last interval.
+ * This also resets the timings for other callers of {@linkcode VisionCameraProxy.getStats | VisionCameraProxy.getStats(..)}.
+ *
+ * @param intervalMs How often to poll the statistics, in milliseconds.
+ * @returns The latest statistics, or `undefined` until the first interval elapsed.
+ * @example
+ * ```tsx
+ * const stats = useVisionCameraStats(1000)
+ * const p99 = stats?.timings.frameProcessor.p99
+ * ```
+ */
+export function useVisionCameraStats(intervalMs = 1000): VisionCameraStats | undefined {
+  const [stats, setStats] = useState<VisionCameraStats>()
+
+  useEffect(() => {
+    const interval = setInterval(() => {
+      setStats(VisionCameraProxy.getStats({ resetTimings: true }))
+    }, intervalMs)
+    return () => clearInterval(interval)
+  }, [intervalMs])
+
+  return stats
+}
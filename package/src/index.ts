@@ -27,6 +27,8 @@ export * from './hooks/useCameraFormat'
 export * from './hooks/useCameraPermission'
 export * from './hooks/useCodeScanner'
 export * from './hooks/useFrameProcessor'
+export * from './hooks/useNativeState'
+export * from './hooks/useVisionCameraStats'
 
 // Frame Processors
 export * from './frame-processors/runAsync'
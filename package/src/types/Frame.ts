@@ -1,6 +1,157 @@
 import type { Orientation } from './Orientation'
 import type { PixelFormat } from './PixelFormat'
 
+/**
+ * A tightly packed 8-bit pixel layout a {@linkcode Frame} can be converted to in {@linkcode Frame.toArrayBuffer | Frame.toArrayBuffer()}.
+ */
+export type ArrayBufferPixelFormat = 'rgb' | 'rgba' | 'bgr' | 'bgra' | 'gray'
+
+/**
+ * Options to rotate and mirror the pixels of a {@linkcode Frame} natively.
+ */
+export interface FrameOrientationOptions {
+  /**
+   * Whether to rotate the pixels so the result appears up-right (`'upright'`, which counter-rotates the
+   * Frame's {@linkcode Frame.orientation | orientation}), or to keep the Frame's original orientation (`'original'`).
+   *
+   * Rotating is done with a tiled, SIMD-accelerated transpose. If possible, prefer passing the Frame's orientation
+   * to your model or library instead, as that does not touch any pixels at all.
+   *
+   * @default 'original'
+   */
+  orientation?: 'upright' | 'original'
+  /**
+   * Whether to flip the result horizontally (after rotating it).
+   * Pass {@linkcode Frame.isMirrored | frame.isMirrored} to match what the Camera preview shows.
+   *
+   * @default false
+   */
+  mirror?: boolean
+}
+
+/**
+ * Options for {@linkcode Frame.toArrayBuffer | Frame.toArrayBuffer()}.
+ *
+ * {@linkcode FrameOrientationOptions.orientation | orientation} and {@linkcode FrameOrientationOptions.mirror | mirror}
+ * can only be used together with {@linkcode pixelFormat}.
+ */
+export interface ToArrayBufferOptions extends FrameOrientationOptions {
+  /**
+   * Whether to copy the Frame's data into a new `ArrayBuffer` (`true`), or to return a view that
+   * points directly at the Frame's memory (`false`).
+   *
+   * @default true
+   */
+  copy?: boolean
+  /**
+   * Converts the Frame into the given pixel layout (using SIMD on the native side) instead of returning
+   * its raw data. The result has no row padding, so its size is exactly `width * height * bytesPerPixel`.
+   *
+   * YUV Frames are converted using BT.601 coefficients. The conversion always copies, so {@linkcode copy} is ignored.
+   * On Android, this requires a `minSdkVersion` of 29 or higher.
+   *
+   * @example
+   * ```ts
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const rgb = new Uint8Array(frame.toArrayBuffer({ pixelFormat: 'rgb' }))
+   *   // rgb.length === frame.width * frame.height * 3
+   * }, [])
+   * ```
+   */
+  pixelFormat?: ArrayBufferPixelFormat
+}
+
+/**
+ * Options for {@linkcode Frame.resize | Frame.resize()}.
+ */
+export interface ResizeOptions extends FrameOrientationOptions {
+  /**
+   * The width of the resulting image (after applying {@linkcode orientation}), in pixels.
+   *
+   * Has to be an integer between 1 and 8192, and the resulting buffer must not be larger than 256 MB.
+   */
+  width: number
+  /**
+   * The height of the resulting image (after applying {@linkcode orientation}), in pixels.
+   *
+   * Has to be an integer between 1 and 8192, and the resulting buffer must not be larger than 256 MB.
+   */
+  height: number
+  /**
+   * The rectangle of the Frame to resize, in Frame pixels (before applying {@linkcode orientation}).
+   *
+   * @default The full Frame
+   */
+  crop?: { x: number; y: number; width: number; height: number }
+  /**
+   * The pixel layout of the resulting image.
+   *
+   * @default 'rgb'
+   */
+  pixelFormat?: ArrayBufferPixelFormat
+  /**
+   * The data type of each channel. `'float32'` values are normalized using {@linkcode mean} and {@linkcode std}
+   * as `(value / 255 - mean) / std`, while `'uint8'` values are in the range `[0...255]`.
+   *
+   * @default 'uint8'
+   */
+  dataType?: 'uint8' | 'float32'
+  /**
+   * How to sample the Frame. `'area'` averages all pixels covered by a target pixel, which avoids aliasing
+   * when scaling down a lot (e.g. 4k to 224x224).
+   *
+   * @default 'bilinear'
+   */
+  interpolation?: 'bilinear' | 'area'
+  /**
+   * The mean to subtract from each channel (R, G, B) for `'float32'` data, either one value for all channels
+   * or one per channel.
+   *
+   * @default 0
+   */
+  mean?: number | number[]
+  /**
+   * The standard deviation to divide each channel (R, G, B) by for `'float32'` data, either one value for all channels
+   * or one per channel.
+   *
+   * @default 1
+   */
+  std?: number | number[]
+}
+
+/**
+ * A single plane of a {@linkcode Frame}, e.g. the Y (luma) or the CbCr (chroma) plane of a YUV Frame.
+ */
+export interface FramePlane {
+  /**
+   * The width of this plane, in pixels. Chroma planes of YUV Frames are subsampled.
+   */
+  width: number
+  /**
+   * The height of this plane, in pixels. Chroma planes of YUV Frames are subsampled.
+   */
+  height: number
+  /**
+   * The distance between the start of two rows in {@linkcode buffer}, in bytes.
+   */
+  bytesPerRow: number
+  /**
+   * The distance between two pixels of a row in {@linkcode buffer}, in bytes.
+   * For example, interleaved chroma planes have a pixel stride of 2.
+   */
+  pixelStride: number
+  /**
+   * The byte offset of this plane relative to the first plane in the Frame's memory.
+   * This is only meaningful if the planes share one allocation (e.g. to detect interleaved chroma planes).
+   */
+  offset: number
+  /**
+   * The pixel data of this plane. The last row is not padded to {@linkcode bytesPerRow}.
+   */
+  buffer: ArrayBuffer
+}
+
 /**
  * A single frame, as seen by the camera. This is backed by a C++ HostObject wrapping the native GPU buffer.
  * At a 4k resolution, a raw Frame can be 12MB in size.
@@ -71,6 +222,15 @@ export interface Frame {
    *
    * Note that Frames are allocated on the GPU, so calling `toArrayBuffer()` will copy from the GPU to the CPU.
    *
+   * Every call returns a new `ArrayBuffer` that stays valid for as long as it is referenced from JS.
+   * The underlying memory is pooled and reused once the `ArrayBuffer` gets garbage-collected.
+   *
+   * If you only need to read the pixels while the Frame is alive, pass `{ copy: false }` to get an
+   * `ArrayBuffer` that points directly at the Frame's memory instead of copying it.
+   * The view keeps the Frame's memory mapped and locked until it gets garbage-collected, so it is always safe to read -
+   * even after the Frame has been closed. Holding on to it for long keeps the Camera from reusing that buffer, though,
+   * so only use it while the Frame is valid (i.e. inside the Frame Processor or `runAsync(...)`).
+   *
    * @example
    * ```ts
    * const frameProcessor = useFrameProcessor((frame) => {
@@ -84,7 +244,53 @@ export interface Frame {
    * }, [])
    * ```
    */
-  toArrayBuffer(): ArrayBuffer
+  toArrayBuffer(options?: ToArrayBufferOptions): ArrayBuffer
+  /**
+   * Get all planes of the Frame, each with its own strides and `ArrayBuffer`.
+   *
+   * Unlike {@linkcode toArrayBuffer | toArrayBuffer()}, this exposes every plane of planar formats
+   * (e.g. Y and CbCr for `yuv`), so you can for example read only the luma plane for grayscale processing.
+   *
+   * Pass `{ copy: false }` to get views that point directly at the Frame's memory instead of copies.
+   * The same rules as for {@linkcode toArrayBuffer | toArrayBuffer({ copy: false })} apply.
+   *
+   * On Android, this requires a minSdkVersion of 29 or higher.
+   *
+   * @example
+   * ```ts
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const [luma] = frame.getPlanes({ copy: false })
+   *   const pixels = new Uint8Array(luma.buffer)
+   *   console.log(`Luma at 0,0: ${pixels[0]}`)
+   * }, [])
+   * ```
+   */
+  getPlanes(options?: ToArrayBufferOptions): FramePlane[]
+  /**
+   * Crops, resizes, converts and normalizes the Frame in a single native pass, which is what most ML models
+   * expect as an input. The work is split across multiple CPU cores and written into a new `ArrayBuffer`
+   * without any row padding.
+   *
+   * On Android, this requires a minSdkVersion of 29 or higher.
+   *
+   * @example
+   * ```ts
+   * const frameProcessor = useFrameProcessor((frame) => {
+   *   'worklet'
+   *   const input = frame.resize({
+   *     width: 224,
+   *     height: 224,
+   *     pixelFormat: 'rgb',
+   *     dataType: 'float32',
+   *     mean: [0.485, 0.456, 0.406],
+   *     std: [0.229, 0.224, 0.225],
+   *   })
+   *   const result = model.runSync([new Float32Array(input)])
+   * }, [])
+   * ```
+   */
+  resize(options: ResizeOptions): ArrayBuffer
   /**
    * Returns a string representation of the frame.
    * @example